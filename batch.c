@@ -0,0 +1,719 @@
+/** !
+ * Batch evaluation of node graphs
+ *
+ * @file batch.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/batch.h>
+
+// Standard library
+#include <math.h>
+
+// x86 intrinsics
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define NODE_BATCH_X86
+#endif
+
+// Preprocessor definitions
+#define NODE_BATCH_ALIGNMENT 64
+
+// Kernels
+/** !
+ * Define the kernels of one operation. Each kernel combines quantity
+ * records of two columns; unary operations read only the first. The x86
+ * kernels expect columns aligned to their vector width, and finish the
+ * records that do not fill a vector with scalar code.
+ */
+#define NODE_BATCH_KERNEL_SCALAR(name, expression)                                                                  \
+    void node_batch_##name##_scalar ( const double *p_a, const double *p_b, double *p_result, size_t quantity )     \
+    {                                                                                                               \
+        for (size_t i = 0; i < quantity; i++)                                                                       \
+        {                                                                                                           \
+            double a = p_a[i], b = p_b[i];                                                                          \
+            (void) a, (void) b;                                                                                     \
+            p_result[i] = ( expression );                                                                           \
+        }                                                                                                           \
+    }
+
+#define NODE_BATCH_KERNEL_SSE2(name, expression, intrinsic)                                                         \
+    __attribute__((target("sse2")))                                                                                 \
+    void node_batch_##name##_sse2 ( const double *p_a, const double *p_b, double *p_result, size_t quantity )       \
+    {                                                                                                               \
+        size_t i = 0;                                                                                               \
+        for (; i + 2 <= quantity; i += 2)                                                                           \
+            _mm_store_pd(p_result + i, intrinsic(_mm_load_pd(p_a + i), _mm_load_pd(p_b + i)));                      \
+        for (; i < quantity; i++)                                                                                   \
+        {                                                                                                           \
+            double a = p_a[i], b = p_b[i];                                                                          \
+            p_result[i] = ( expression );                                                                           \
+        }                                                                                                           \
+    }
+
+#define NODE_BATCH_KERNEL_AVX2(name, expression, intrinsic)                                                         \
+    __attribute__((target("avx2")))                                                                                 \
+    void node_batch_##name##_avx2 ( const double *p_a, const double *p_b, double *p_result, size_t quantity )       \
+    {                                                                                                               \
+        size_t i = 0;                                                                                               \
+        for (; i + 4 <= quantity; i += 4)                                                                           \
+            _mm256_store_pd(p_result + i, intrinsic(_mm256_load_pd(p_a + i), _mm256_load_pd(p_b + i)));             \
+        for (; i < quantity; i++)                                                                                   \
+        {                                                                                                           \
+            double a = p_a[i], b = p_b[i];                                                                          \
+            p_result[i] = ( expression );                                                                           \
+        }                                                                                                           \
+    }
+
+NODE_BATCH_KERNEL_SCALAR(add,      a + b)
+NODE_BATCH_KERNEL_SCALAR(subtract, a - b)
+NODE_BATCH_KERNEL_SCALAR(multiply, a * b)
+NODE_BATCH_KERNEL_SCALAR(divide,   a / b)
+NODE_BATCH_KERNEL_SCALAR(min,      ( a < b ) ? a : b)
+NODE_BATCH_KERNEL_SCALAR(max,      ( a > b ) ? a : b)
+NODE_BATCH_KERNEL_SCALAR(negate,   -a)
+NODE_BATCH_KERNEL_SCALAR(abs,      fabs(a))
+NODE_BATCH_KERNEL_SCALAR(sqrt,     sqrt(a))
+
+#ifdef NODE_BATCH_X86
+    NODE_BATCH_KERNEL_SSE2(add,      a + b,             _mm_add_pd)
+    NODE_BATCH_KERNEL_SSE2(subtract, a - b,             _mm_sub_pd)
+    NODE_BATCH_KERNEL_SSE2(multiply, a * b,             _mm_mul_pd)
+    NODE_BATCH_KERNEL_SSE2(divide,   a / b,             _mm_div_pd)
+    NODE_BATCH_KERNEL_SSE2(min,      ( a < b ) ? a : b, _mm_min_pd)
+    NODE_BATCH_KERNEL_SSE2(max,      ( a > b ) ? a : b, _mm_max_pd)
+
+    NODE_BATCH_KERNEL_AVX2(add,      a + b,             _mm256_add_pd)
+    NODE_BATCH_KERNEL_AVX2(subtract, a - b,             _mm256_sub_pd)
+    NODE_BATCH_KERNEL_AVX2(multiply, a * b,             _mm256_mul_pd)
+    NODE_BATCH_KERNEL_AVX2(divide,   a / b,             _mm256_div_pd)
+    NODE_BATCH_KERNEL_AVX2(min,      ( a < b ) ? a : b, _mm256_min_pd)
+    NODE_BATCH_KERNEL_AVX2(max,      ( a > b ) ? a : b, _mm256_max_pd)
+#endif
+
+// Function definitions
+void node_batch_kernels ( fn_node_batch_kernel *const p_kernels )
+{
+
+    // Initialized data
+    static const fn_node_batch_kernel _scalar[NODE_EXPRESSION_OP_QUANTITY] =
+    {
+        [NODE_EXPRESSION_ADD]      = node_batch_add_scalar,
+        [NODE_EXPRESSION_SUBTRACT] = node_batch_subtract_scalar,
+        [NODE_EXPRESSION_MULTIPLY] = node_batch_multiply_scalar,
+        [NODE_EXPRESSION_DIVIDE]   = node_batch_divide_scalar,
+        [NODE_EXPRESSION_MIN]      = node_batch_min_scalar,
+        [NODE_EXPRESSION_MAX]      = node_batch_max_scalar,
+        [NODE_EXPRESSION_NEGATE]   = node_batch_negate_scalar,
+        [NODE_EXPRESSION_ABS]      = node_batch_abs_scalar,
+        [NODE_EXPRESSION_SQRT]     = node_batch_sqrt_scalar
+    };
+
+    // Start from scalar code
+    memcpy(p_kernels, _scalar, sizeof(_scalar));
+
+    #ifdef NODE_BATCH_X86
+
+        // Use the widest binary kernels the processor supports. Unary
+        // kernels stay scalar, and are left to the compiler
+        if ( __builtin_cpu_supports("avx2") )
+            p_kernels[NODE_EXPRESSION_ADD]      = node_batch_add_avx2,
+            p_kernels[NODE_EXPRESSION_SUBTRACT] = node_batch_subtract_avx2,
+            p_kernels[NODE_EXPRESSION_MULTIPLY] = node_batch_multiply_avx2,
+            p_kernels[NODE_EXPRESSION_DIVIDE]   = node_batch_divide_avx2,
+            p_kernels[NODE_EXPRESSION_MIN]      = node_batch_min_avx2,
+            p_kernels[NODE_EXPRESSION_MAX]      = node_batch_max_avx2;
+        else if ( __builtin_cpu_supports("sse2") )
+            p_kernels[NODE_EXPRESSION_ADD]      = node_batch_add_sse2,
+            p_kernels[NODE_EXPRESSION_SUBTRACT] = node_batch_subtract_sse2,
+            p_kernels[NODE_EXPRESSION_MULTIPLY] = node_batch_multiply_sse2,
+            p_kernels[NODE_EXPRESSION_DIVIDE]   = node_batch_divide_sse2,
+            p_kernels[NODE_EXPRESSION_MIN]      = node_batch_min_sse2,
+            p_kernels[NODE_EXPRESSION_MAX]      = node_batch_max_sse2;
+    #endif
+}
+
+int node_batch_fuse ( node_batch *const p_node_batch, node_batch_step *const p_step, const size_t *const p_producers, const size_t *const p_readers )
+{
+
+    // Fuse the producer of each input, until none is left to fuse
+    for (size_t k = 0; k < p_step->p_expression->input_quantity; )
+    {
+
+        // Initialized data
+        size_t column = p_step->p_sources[k],
+               producer = p_producers[column];
+        node_batch_step *p_producer = ( producer == SIZE_MAX ) ? (void *) 0 : &p_node_batch->p_steps[producer];
+        node_expression *p_fused = (void *) 0;
+        size_t *p_sources = (void *) 0;
+
+        // The producer must be an expression whose only output feeds only this input
+        if ( p_producer == (void *) 0 || p_producer->p_expression == (void *) 0 || p_producer->fused ||
+             p_producer->p_node->out_quantity != 1 || p_readers[column] != 1 ||
+             node_expression_fuse(&p_fused, p_step->p_expression, k, p_producer->p_expression) == 0 )
+        {
+            k++;
+
+            continue;
+        }
+
+        // Allocate the sources of the fused expression
+        p_sources = NODE_REALLOC(0, ( p_fused->input_quantity ? p_fused->input_quantity : 1 ) * sizeof(size_t));
+
+        // Error check
+        if ( p_sources == (void *) 0 )
+        {
+
+            // Release the fused expression
+            node_expression_destroy(&p_fused);
+
+            // Error
+            goto no_mem;
+        }
+
+        // The sources of the consumer without the fed input, then the sources of the producer
+        memcpy(p_sources, p_step->p_sources, k * sizeof(size_t));
+        memcpy(p_sources + k, p_step->p_sources + k + 1, ( p_step->p_expression->input_quantity - k - 1 ) * sizeof(size_t));
+        memcpy(p_sources + p_step->p_expression->input_quantity - 1, p_producer->p_sources, p_producer->p_expression->input_quantity * sizeof(size_t));
+
+        // Replace the expression
+        node_expression_destroy(&p_step->p_expression);
+        p_step->p_sources    = NODE_REALLOC(p_step->p_sources, 0);
+        p_step->p_expression = p_fused,
+        p_step->p_sources    = p_sources;
+
+        // The producer runs inside this step now
+        p_producer->fused = true;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_batch_construct ( node_batch **const pp_node_batch, node_graph *const p_node_graph, size_t capacity )
+{
+
+    // Argument check
+    if ( pp_node_batch == (void *) 0 ) goto no_node_batch;
+    if ( p_node_graph  == (void *) 0 ) goto no_node_graph;
+    if ( capacity      ==          0 ) goto no_capacity;
+
+    // Initialized data
+    node_batch *p_node_batch = (void *) 0;
+    node_schedule *p_schedule = (void *) 0;
+    size_t *p_producers = (void *) 0,
+           *p_readers   = (void *) 0;
+    size_t column_quantity   = 1,
+           input_quantity    = 0,
+           in_max            = 0,
+           out_max           = 0,
+           column            = 1,
+           register_max      = 1,
+           temporary_max     = 1;
+
+    // Compile the graph
+    if ( p_node_graph->p_schedule == (void *) 0 )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Store the schedule
+    p_schedule = p_node_graph->p_schedule;
+
+    // Count the columns and inputs
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_schedule->p_entries[i].p_node;
+
+        // Accumulate the ports
+        column_quantity += p_node->out_quantity,
+        input_quantity  += p_node->in_quantity;
+
+        // Track the widest node
+        if ( p_node->in_quantity  > in_max  ) in_max  = p_node->in_quantity;
+        if ( p_node->out_quantity > out_max ) out_max = p_node->out_quantity;
+    }
+
+    // Allocate the batch
+    p_node_batch = NODE_REALLOC(0, sizeof(node_batch));
+
+    // Error check
+    if ( p_node_batch == (void *) 0 ) goto no_mem;
+
+    // Populate the batch. Columns are padded to a multiple of the alignment
+    *p_node_batch = (node_batch)
+    {
+        .p_node_graph    = p_node_graph,
+        .capacity        = capacity,
+        .stride          = ( capacity + ( NODE_BATCH_ALIGNMENT / sizeof(double) ) - 1 ) & ~( NODE_BATCH_ALIGNMENT / sizeof(double) - 1 ),
+        .column_quantity = column_quantity,
+        .step_quantity   = p_schedule->entry_quantity,
+        .p_steps         = NODE_REALLOC(0, ( p_schedule->entry_quantity ? p_schedule->entry_quantity : 1 ) * sizeof(node_batch_step)),
+        .p_inputs        = NODE_REALLOC(0, ( input_quantity ? input_quantity : 1 ) * sizeof(size_t)),
+        .pp_in           = NODE_REALLOC(0, ( in_max ? in_max : 1 ) * sizeof(const double *)),
+        .pp_out          = NODE_REALLOC(0, ( out_max ? out_max : 1 ) * sizeof(double *))
+    };
+
+    // Steps start out empty, so a partial batch can be released
+    if ( p_node_batch->p_steps ) memset(p_node_batch->p_steps, 0, ( p_schedule->entry_quantity ? p_schedule->entry_quantity : 1 ) * sizeof(node_batch_step));
+
+    // Allocate the columns, with room to align them, and the fusion scratch
+    p_node_batch->p_block = NODE_REALLOC(0, column_quantity * p_node_batch->stride * sizeof(double) + NODE_BATCH_ALIGNMENT);
+    p_producers           = NODE_REALLOC(0, column_quantity * sizeof(size_t));
+    p_readers             = NODE_REALLOC(0, column_quantity * sizeof(size_t));
+
+    // Error check
+    if ( p_node_batch->p_steps  == (void *) 0 ) goto no_mem;
+    if ( p_node_batch->p_inputs == (void *) 0 ) goto no_mem;
+    if ( p_node_batch->pp_in    == (void *) 0 ) goto no_mem;
+    if ( p_node_batch->pp_out   == (void *) 0 ) goto no_mem;
+    if ( p_node_batch->p_block  == (void *) 0 ) goto no_mem;
+    if ( p_producers            == (void *) 0 ) goto no_mem;
+    if ( p_readers              == (void *) 0 ) goto no_mem;
+
+    // Align the columns
+    p_node_batch->p_columns = (double *) ( ( (uintptr_t) p_node_batch->p_block + NODE_BATCH_ALIGNMENT - 1 ) & ~ (uintptr_t) ( NODE_BATCH_ALIGNMENT - 1 ) );
+
+    // Every column starts out zero
+    memset(p_node_batch->p_columns, 0, column_quantity * p_node_batch->stride * sizeof(double));
+
+    // No column has a producer or readers yet
+    memset(p_readers, 0, column_quantity * sizeof(size_t));
+    p_producers[0] = SIZE_MAX;
+
+    // Give the outputs of each node their columns
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = p_schedule->p_entries[i].p_node;
+
+        // Store the step
+        p_node_batch->p_steps[i] = (node_batch_step)
+        {
+            .p_node        = p_node,
+            .input_offset  = p_schedule->p_entries[i].input_offset,
+            .output_column = column
+        };
+
+        // Each of its columns is produced by this step
+        for (size_t j = 0; j < p_node->out_quantity; j++) p_producers[column++] = i;
+    }
+
+    // Choose the kernels
+    node_batch_kernels(p_node_batch->pfn_kernels);
+
+    // Find the column that feeds each input, and compile each expression
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+    {
+
+        // Initialized data
+        node_batch_step *p_step = &p_node_batch->p_steps[i];
+        const node *p_node = p_step->p_node;
+        size_t *p_inputs = p_node_batch->p_inputs + p_step->input_offset;
+
+        // Inputs read the column of the output that feeds them, or the zero column
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            p_inputs[k] = ( p_node->in[k].p_in ) ? p_node_batch->p_steps[p_node->in[k].p_in->position].output_column + p_node->in[k].out_index : 0,
+            p_readers[p_inputs[k]]++;
+
+        // Nodes with a batch function, nodes without an output, and nodes without an expression, have no kernel
+        if ( p_node->pfn_batch_function ) continue;
+        if ( p_node->out_quantity == 0 ) continue;
+        if ( node_expression_node_compile(&p_step->p_expression, p_node) == 0 ) continue;
+
+        // Allocate the sources of the expression
+        p_step->p_sources = NODE_REALLOC(0, ( p_node->in_quantity ? p_node->in_quantity : 1 ) * sizeof(size_t));
+
+        // Error check
+        if ( p_step->p_sources == (void *) 0 ) goto no_mem;
+
+        // Each input register reads the column of its port
+        if ( p_node->in_quantity ) memcpy(p_step->p_sources, p_inputs, p_node->in_quantity * sizeof(size_t));
+    }
+
+    // Fuse chains of expressions. Producers come first in the schedule, 
+    // so each producer has already absorbed its own chain
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+    {
+
+        // Initialized data
+        node_batch_step *p_step = &p_node_batch->p_steps[i];
+
+        // Skip steps without an expression
+        if ( p_step->p_expression == (void *) 0 ) continue;
+
+        // Fuse the producers of the step
+        if ( node_batch_fuse(p_node_batch, p_step, p_producers, p_readers) == 0 ) goto failed_to_fuse;
+    }
+
+    // Size the registers and the scratch for the widest expression that runs
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+    {
+
+        // Initialized data
+        const node_expression *p_expression = p_node_batch->p_steps[i].p_expression;
+
+        // Skip steps that do not run an expression
+        if ( p_expression == (void *) 0 || p_node_batch->p_steps[i].fused ) continue;
+
+        // Track the widest expression
+        if ( p_expression->register_quantity > register_max ) register_max = p_expression->register_quantity;
+        if ( p_expression->register_quantity - p_expression->input_quantity > temporary_max ) temporary_max = p_expression->register_quantity - p_expression->input_quantity;
+    }
+
+    // Allocate the registers, and the scratch, with room to align it
+    p_node_batch->pp_registers    = NODE_REALLOC(0, register_max * sizeof(double *));
+    p_node_batch->p_scratch_block = NODE_REALLOC(0, temporary_max * NODE_BATCH_TILE_SIZE * sizeof(double) + NODE_BATCH_ALIGNMENT);
+
+    // Error check
+    if ( p_node_batch->pp_registers    == (void *) 0 ) goto no_mem;
+    if ( p_node_batch->p_scratch_block == (void *) 0 ) goto no_mem;
+
+    // Align the scratch
+    p_node_batch->p_scratch = (double *) ( ( (uintptr_t) p_node_batch->p_scratch_block + NODE_BATCH_ALIGNMENT - 1 ) & ~ (uintptr_t) ( NODE_BATCH_ALIGNMENT - 1 ) );
+
+    // Release the fusion scratch
+    p_producers = NODE_REALLOC(p_producers, 0);
+    p_readers   = NODE_REALLOC(p_readers, 0);
+
+    // Return a pointer to the caller
+    *pp_node_batch = p_node_batch;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_batch:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Null pointer provided for parameter \"pp_node_batch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_capacity:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Parameter \"capacity\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_compile:
+
+                // Error
+                return 0;
+
+            failed_to_fuse:
+
+                // Release the fusion scratch
+                p_producers = NODE_REALLOC(p_producers, 0);
+                p_readers   = NODE_REALLOC(p_readers, 0);
+
+                // Release the partial batch
+                node_batch_destroy(&p_node_batch);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the fusion scratch
+                if ( p_producers ) p_producers = NODE_REALLOC(p_producers, 0);
+                if ( p_readers   ) p_readers   = NODE_REALLOC(p_readers, 0);
+
+                // Release the partial batch
+                if ( p_node_batch ) node_batch_destroy(&p_node_batch);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_batch_column ( node_batch *const p_node_batch, const char *const p_port, bool input, double **const pp_column )
+{
+
+    // Argument check
+    if ( p_node_batch == (void *) 0 ) goto no_node_batch;
+    if ( p_port       == (void *) 0 ) goto no_port;
+    if ( pp_column    == (void *) 0 ) goto no_column;
+
+    // Initialized data
+    node *p_node = (void *) 0;
+    size_t index = 0,
+           column = 0;
+
+    // Find the port
+    if ( node_graph_port_resolve(p_node_batch->p_node_graph, p_port, input, &p_node, &index) == 0 ) goto failed_to_resolve;
+
+    // Store the column
+    column = ( input ) ? p_node_batch->p_inputs[p_node_batch->p_steps[p_node->position].input_offset + index] 
+                       : p_node_batch->p_steps[p_node->position].output_column + index;
+
+    // Return a pointer to the caller
+    *pp_column = p_node_batch->p_columns + column * p_node_batch->stride;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_batch:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Null pointer provided for parameter \"p_node_batch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_port:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Null pointer provided for parameter \"p_port\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_column:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Null pointer provided for parameter \"pp_column\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_resolve:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_batch_evaluate ( node_batch *const p_node_batch, const node_batch_step *const p_step, size_t offset, size_t quantity )
+{
+
+    // Initialized data
+    const node_expression *p_expression = p_step->p_expression;
+    const node_expression_instruction *p_instruction = p_expression->p_instructions,
+                                      *p_end         = p_instruction + p_expression->instruction_quantity;
+    double **pp_registers = p_node_batch->pp_registers,
+           *p_output      = p_node_batch->p_columns + p_step->output_column * p_node_batch->stride + offset;
+
+    // Input registers point at the tile of their column, and temporaries
+    // at the scratch. The result is computed in place, in the output
+    for (size_t r = 0; r < p_expression->input_quantity; r++)
+        pp_registers[r] = p_node_batch->p_columns + p_step->p_sources[r] * p_node_batch->stride + offset;
+    for (size_t r = p_expression->input_quantity; r < p_expression->register_quantity; r++)
+        pp_registers[r] = p_node_batch->p_scratch + ( r - p_expression->input_quantity ) * NODE_BATCH_TILE_SIZE;
+    if ( p_expression->result >= p_expression->input_quantity )
+        pp_registers[p_expression->result] = p_output;
+
+    // Run each instruction over the tile
+    for (; p_instruction < p_end; p_instruction++)
+    {
+
+        // Broadcast a constant
+        if ( p_instruction->op == NODE_EXPRESSION_CONSTANT )
+        {
+
+            // Initialized data
+            double value = p_expression->_constants[(size_t) p_instruction->a | (size_t) p_instruction->b << 8];
+            double *p_result = pp_registers[p_instruction->result];
+
+            // Fill the register
+            for (size_t i = 0; i < quantity; i++) p_result[i] = value;
+
+            continue;
+        }
+
+        // Run the kernel
+        p_node_batch->pfn_kernels[p_instruction->op](pp_registers[p_instruction->a], pp_registers[p_instruction->b], pp_registers[p_instruction->result], quantity);
+    }
+
+    // An expression that is just an input copies it
+    if ( p_expression->result < p_expression->input_quantity )
+        memcpy(p_output, pp_registers[p_expression->result], quantity * sizeof(double));
+}
+
+int node_batch_run ( node_batch *const p_node_batch, size_t quantity )
+{
+
+    // Argument check
+    if ( p_node_batch == (void *) 0             ) goto no_node_batch;
+    if ( quantity     >  p_node_batch->capacity ) goto too_many_records;
+
+    // Initialized data
+    const double *p_columns = p_node_batch->p_columns;
+    size_t stride = p_node_batch->stride,
+           i      = 0;
+
+    // Walk the schedule once per tile
+    for (size_t t = 0; t < quantity; t += NODE_BATCH_TILE_SIZE)
+    {
+
+        // Initialized data
+        size_t n = ( quantity - t < NODE_BATCH_TILE_SIZE ) ? quantity - t : NODE_BATCH_TILE_SIZE;
+
+        // Run each node over the tile
+        for (i = 0; i < p_node_batch->step_quantity; i++)
+        {
+
+            // Initialized data
+            const node_batch_step *p_step = &p_node_batch->p_steps[i];
+            node *p_node = p_step->p_node;
+
+            // Call the batch function with the columns of the node
+            if ( p_node->pfn_batch_function )
+            {
+
+                // Point at the tile of each input and output
+                for (size_t k = 0; k < p_node->in_quantity; k++)
+                    p_node_batch->pp_in[k] = p_columns + p_node_batch->p_inputs[p_step->input_offset + k] * stride + t;
+                for (size_t j = 0; j < p_node->out_quantity; j++)
+                    p_node_batch->pp_out[j] = p_node_batch->p_columns + ( p_step->output_column + j ) * stride + t;
+
+                // Run the node
+                if ( p_node->pfn_batch_function(p_node, p_node_batch->pp_in, p_node_batch->pp_out, n) == 0 ) goto failed_to_run_node;
+            }
+
+            // Or, run the expression, unless it is fused into a later step
+            else if ( p_step->p_expression && p_step->fused == false )
+                node_batch_evaluate(p_node_batch, p_step, t, n);
+        }
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_batch:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Null pointer provided for parameter \"p_node_batch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            too_many_records:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Parameter \"quantity\" must not exceed the capacity of the batch in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_run_node:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Failed to run node \"%s\" in call to function \"%s\"\n", p_node_batch->p_steps[i].p_node->p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_batch_destroy ( node_batch **const pp_node_batch )
+{
+
+    // Argument check
+    if ( pp_node_batch  == (void *) 0 ) goto no_node_batch;
+    if ( *pp_node_batch == (void *) 0 ) goto no_node_batch;
+
+    // Initialized data
+    node_batch *p_node_batch = *pp_node_batch;
+
+    // No more pointer for caller
+    *pp_node_batch = (void *) 0;
+
+    // Release the expressions of each step
+    for (size_t i = 0; p_node_batch->p_steps && i < p_node_batch->step_quantity; i++)
+    {
+        if ( p_node_batch->p_steps[i].p_expression ) node_expression_destroy(&p_node_batch->p_steps[i].p_expression);
+        if ( p_node_batch->p_steps[i].p_sources    ) p_node_batch->p_steps[i].p_sources = NODE_REALLOC(p_node_batch->p_steps[i].p_sources, 0);
+    }
+
+    // Release the columns, the steps, and the scratch
+    if ( p_node_batch->p_block         ) p_node_batch->p_block         = NODE_REALLOC(p_node_batch->p_block, 0);
+    if ( p_node_batch->p_scratch_block ) p_node_batch->p_scratch_block = NODE_REALLOC(p_node_batch->p_scratch_block, 0);
+    if ( p_node_batch->pp_registers    ) p_node_batch->pp_registers    = NODE_REALLOC(p_node_batch->pp_registers, 0);
+    if ( p_node_batch->p_steps  ) p_node_batch->p_steps  = NODE_REALLOC(p_node_batch->p_steps, 0);
+    if ( p_node_batch->p_inputs ) p_node_batch->p_inputs = NODE_REALLOC(p_node_batch->p_inputs, 0);
+    if ( p_node_batch->pp_in    ) p_node_batch->pp_in    = NODE_REALLOC(p_node_batch->pp_in, 0);
+    if ( p_node_batch->pp_out   ) p_node_batch->pp_out   = NODE_REALLOC(p_node_batch->pp_out, 0);
+
+    // Release the batch
+    p_node_batch = NODE_REALLOC(p_node_batch, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_batch:
+                #ifndef NDEBUG
+                    log_error("[node] [batch] Null pointer provided for parameter \"pp_node_batch\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
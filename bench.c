@@ -0,0 +1,708 @@
+/** !
+ *  Benchmark node graphs of synthetic shapes and sizes
+ *
+ * Each case generates the json text of a graph, then times parsing it,
+ * constructing the graph, compiling it, executing it once serially, 
+ * once on an executor and once as a batch of one record, and tearing
+ * it down. Before any execution is timed, the executor and the batch
+ * are checked against the serial result. Every case runs in a process of its own, so its peak
+ * resident set is its own. Results are written to standard out as one
+ * json object per line and phase.
+ *
+ * @file bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+// node module
+#include <node/node.h>
+#include <node/executor.h>
+#include <node/batch.h>
+
+// Children of each container of a nested graph
+#define NODE_BENCH_NESTED_WIDTH 8
+
+// Node values wrap at this prime, so they stay exact in a double
+#define NODE_BENCH_MODULUS 1000003
+
+// Structure declarations
+struct node_bench_text_s;
+struct node_bench_shape_s;
+
+// Type definitions
+typedef struct node_bench_text_s node_bench_text;
+typedef struct node_bench_shape_s node_bench_shape;
+
+typedef int (*fn_node_bench_generator) ( node_bench_text *p_text, size_t quantity );
+
+// Structure definitions
+/** !
+ * A growable buffer of text
+ */
+struct node_bench_text_s
+{
+    char *p_data;
+    size_t length;
+    size_t capacity;
+};
+
+/** !
+ * A named generator of graphs of some shape
+ */
+struct node_bench_shape_s
+{
+    const char *p_name;
+    fn_node_bench_generator pfn_generator;
+};
+
+// Function definitions
+int node_bench_append ( node_bench_text *p_text, const char *const p_format, ... )
+{
+
+    // Initialized data
+    va_list list;
+    int written = 0;
+
+    // Format into the room that is left, growing until it fits
+    for (;;)
+    {
+
+        // Initialized data
+        size_t room = p_text->capacity - p_text->length;
+        char *p_data = (void *) 0;
+
+        // Format the text
+        va_start(list, p_format);
+        written = vsnprintf(p_text->p_data ? p_text->p_data + p_text->length : (void *) 0, room, p_format, list);
+        va_end(list);
+
+        // Error check
+        if ( written < 0 ) return 0;
+
+        // Done
+        if ( (size_t) written < room ) break;
+
+        // Grow the buffer
+        p_data = realloc(p_text->p_data, ( p_text->capacity + (size_t) written + 1 ) * 2);
+
+        // Error check
+        if ( p_data == (void *) 0 ) return 0;
+
+        // Store the buffer
+        p_text->p_data   = p_data,
+        p_text->capacity = ( p_text->capacity + (size_t) written + 1 ) * 2;
+    }
+
+    // Advance the cursor
+    p_text->length += (size_t) written;
+
+    // Success
+    return 1;
+}
+
+uint64_t node_bench_random ( uint64_t *p_state )
+{
+
+    // xorshift64
+    *p_state ^= *p_state << 13,
+    *p_state ^= *p_state >> 7,
+    *p_state ^= *p_state << 17;
+
+    // Done
+    return *p_state;
+}
+
+int node_bench_chain ( node_bench_text *p_text, size_t quantity )
+{
+
+    // Each node feeds the next
+    if ( node_bench_append(p_text, "{\"nodes\":{") == 0 ) return 0;
+    for (size_t i = 0; i < quantity; i++)
+        if ( node_bench_append(p_text, "%s\"n%zu\":{\"in\":[\"i\"],\"out\":[\"o\"]}", ( i ) ? "," : "", i) == 0 ) return 0;
+    if ( node_bench_append(p_text, "},\"connections\":[") == 0 ) return 0;
+    for (size_t i = 1; i < quantity; i++)
+        if ( node_bench_append(p_text, "%s[\"n%zu:o\",\"n%zu:i\"]", ( i > 1 ) ? "," : "", i - 1, i) == 0 ) return 0;
+
+    // Done
+    return node_bench_append(p_text, "]}");
+}
+
+int node_bench_fan ( node_bench_text *p_text, size_t quantity )
+{
+
+    // One node feeds every other node
+    if ( node_bench_append(p_text, "{\"nodes\":{\"n0\":{\"out\":[\"o\"]}") == 0 ) return 0;
+    for (size_t i = 1; i < quantity; i++)
+        if ( node_bench_append(p_text, ",\"n%zu\":{\"in\":[\"i\"],\"out\":[\"o\"]}", i) == 0 ) return 0;
+    if ( node_bench_append(p_text, "},\"connections\":[") == 0 ) return 0;
+    for (size_t i = 1; i < quantity; i++)
+        if ( node_bench_append(p_text, "%s[\"n0:o\",\"n%zu:i\"]", ( i > 1 ) ? "," : "", i) == 0 ) return 0;
+
+    // Done
+    return node_bench_append(p_text, "]}");
+}
+
+int node_bench_layered ( node_bench_text *p_text, size_t quantity )
+{
+
+    // Initialized data
+    uint64_t state = 0x9e3779b97f4a7c15;
+    size_t width = 1;
+    bool first = true;
+
+    // Square layers
+    while ( ( width + 1 ) * ( width + 1 ) <= quantity ) width++;
+
+    // Each node past the first layer reads two random nodes of the layer before it
+    if ( node_bench_append(p_text, "{\"nodes\":{") == 0 ) return 0;
+    for (size_t i = 0; i < quantity; i++)
+        if ( node_bench_append(p_text, "%s\"n%zu\":{\"in\":[\"a\",\"b\"],\"out\":[\"o\"]}", ( i ) ? "," : "", i) == 0 ) return 0;
+    if ( node_bench_append(p_text, "},\"connections\":[") == 0 ) return 0;
+    for (size_t i = width; i < quantity; i++)
+    {
+
+        // Initialized data
+        size_t previous = ( i / width - 1 ) * width,
+               a = previous + node_bench_random(&state) % width,
+               b = previous + node_bench_random(&state) % width;
+
+        // Connect both inputs
+        if ( node_bench_append(p_text, "%s[\"n%zu:o\",\"n%zu:a\"],[\"n%zu:o\",\"n%zu:b\"]", ( first ) ? "" : ",", a, i, b, i) == 0 ) return 0;
+
+        first = false;
+    }
+
+    // Done
+    return node_bench_append(p_text, "]}");
+}
+
+int node_bench_nested ( node_bench_text *p_text, size_t quantity )
+{
+
+    // A few nodes are a chain of leaves
+    if ( quantity <= NODE_BENCH_NESTED_WIDTH ) return node_bench_chain(p_text, quantity);
+
+    // Otherwise, a chain of containers, each holding its share of the nodes
+    if ( node_bench_append(p_text, "{\"nodes\":{") == 0 ) return 0;
+    for (size_t c = 0; c < NODE_BENCH_NESTED_WIDTH; c++)
+    {
+
+        // Initialized data
+        size_t share = quantity / NODE_BENCH_NESTED_WIDTH + ( c < quantity % NODE_BENCH_NESTED_WIDTH );
+
+        // The container, and its graph
+        if ( node_bench_append(p_text, "%s\"n%zu\":{\"in\":[\"i\"],\"out\":[\"o\"],\"data\":{\"graph\":", ( c ) ? "," : "", c) == 0 ) return 0;
+        if ( node_bench_nested(p_text, share) == 0 ) return 0;
+        if ( node_bench_append(p_text, "}}") == 0 ) return 0;
+    }
+    if ( node_bench_append(p_text, "},\"connections\":[") == 0 ) return 0;
+    for (size_t c = 1; c < NODE_BENCH_NESTED_WIDTH; c++)
+        if ( node_bench_append(p_text, "%s[\"n%zu:o\",\"n%zu:i\"]", ( c > 1 ) ? "," : "", c - 1, c) == 0 ) return 0;
+
+    // Done
+    return node_bench_append(p_text, "]}");
+}
+
+int node_bench_function ( node *p_node )
+{
+
+    // Initialized data
+    uint64_t sum = 1;
+
+    // Add up the inputs. Unconnected inputs read zero
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+        sum += (uint64_t) (uintptr_t) p_node->in[k].value;
+
+    // Write the sum to every output
+    for (size_t j = 0; j < p_node->out_quantity; j++)
+        p_node->out[j].value = (void *) (uintptr_t) ( sum % NODE_BENCH_MODULUS );
+
+    // Success
+    return 1;
+}
+
+int node_bench_batch_function ( node *p_node, const double *const *pp_in, double *const *pp_out, size_t quantity )
+{
+
+    // Compute what node_bench_function does, for each record
+    for (size_t r = 0; r < quantity; r++)
+    {
+
+        // Initialized data
+        uint64_t sum = 1;
+
+        // Add up the inputs
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            sum += (uint64_t) pp_in[k][r];
+
+        // Write the sum to every output
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+            pp_out[j][r] = (double) ( sum % NODE_BENCH_MODULUS );
+    }
+
+    // Success
+    return 1;
+}
+
+int node_bench_verify ( node_graph *p_node_graph, node_executor *p_node_executor, node_batch *p_node_batch )
+{
+
+    // Initialized data
+    size_t node_quantity = p_node_graph->node_quantity;
+    uintptr_t *p_expected = realloc(0, ( node_quantity + 1 ) * sizeof(uintptr_t));
+    const node *p_node = (void *) 0;
+
+    // Error check
+    if ( p_expected == (void *) 0 ) goto no_mem;
+
+    // The serial run is the reference
+    if ( node_graph_execute(p_node_graph) == 0 ) goto failed_to_execute;
+
+    // Store the first output of each node, then clear every output
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_output_node = p_node_graph->_p_nodes[i];
+
+        // Store the value
+        p_expected[i] = ( p_output_node->out_quantity ) ? (uintptr_t) p_output_node->out[0].value : 0;
+
+        // Clear the outputs, so the executor writes its own
+        for (size_t j = 0; j < p_output_node->out_quantity; j++) p_output_node->out[j].value = (void *) 0;
+    }
+
+    // Run the graph on the executor
+    if ( node_executor_run(p_node_executor, p_node_graph) == 0 ) goto failed_to_run_executor;
+
+    // Compare each node
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Store the node
+        p_node = p_node_graph->_p_nodes[i];
+
+        // Error check
+        if ( p_node->out_quantity && (uintptr_t) p_node->out[0].value != p_expected[i] ) goto executor_mismatch;
+    }
+
+    // Run the graph as a batch of one record
+    if ( node_batch_run(p_node_batch, 1) == 0 ) goto failed_to_run_batch;
+
+    // Compare each node. Steps are in schedule order
+    for (size_t i = 0; i < p_node_batch->step_quantity; i++)
+    {
+
+        // Initialized data
+        const node_batch_step *p_step = &p_node_batch->p_steps[i];
+        const double *p_column = p_node_batch->p_columns + p_step->output_column * p_node_batch->stride;
+
+        // Store the node
+        p_node = p_step->p_node;
+
+        // Error check
+        if ( p_node->out_quantity && (uintptr_t) p_column[0] != p_expected[p_node->index] ) goto batch_mismatch;
+    }
+
+    // Release memory
+    free(p_expected);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Node errors
+        {
+            failed_to_execute:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to execute node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+
+            failed_to_run_executor:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to run node graph on executor in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+
+            failed_to_run_batch:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to run node graph as a batch in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+
+            executor_mismatch:
+                #ifndef NDEBUG
+                    log_error("[bench] Executor output of node \"%s\" does not match the serial run in call to function \"%s\"\n", p_node->p_name, __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+
+            batch_mismatch:
+                #ifndef NDEBUG
+                    log_error("[bench] Batch output of node \"%s\" does not match the serial run in call to function \"%s\"\n", p_node->p_name, __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Release memory
+        release:
+            free(p_expected);
+
+            // Error
+            return 0;
+    }
+}
+
+uint64_t node_bench_now ( void )
+{
+
+    // Initialized data
+    struct timespec now = { 0 };
+
+    // Read the clock
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    // Done
+    return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+void node_bench_report ( const char *const p_shape, size_t size, size_t node_quantity, size_t edge_quantity, const char *const p_phase, uint64_t ns )
+{
+
+    // Initialized data
+    struct rusage usage = { 0 };
+
+    // Peak resident set so far, in kilobytes
+    getrusage(RUSAGE_SELF, &usage);
+
+    // One object per line
+    printf("{\"shape\":\"%s\",\"size\":%zu,\"nodes\":%zu,\"edges\":%zu,\"phase\":\"%s\",\"ns\":%llu,\"ns_per_node\":%.3f,\"ns_per_edge\":%.3f,\"peak_rss_kb\":%ld}\n",
+        p_shape, size, node_quantity, edge_quantity, p_phase,
+        (unsigned long long) ns,
+        ( node_quantity ) ? (double) ns / (double) node_quantity : 0.0,
+        ( edge_quantity ) ? (double) ns / (double) edge_quantity : 0.0,
+        usage.ru_maxrss
+    );
+}
+
+int node_bench_run ( const node_bench_shape *const p_shape, size_t size )
+{
+
+    // Initialized data
+    node_bench_text _text = { 0 };
+    json_value *p_value = (void *) 0;
+    node_graph *p_node_graph = (void *) 0;
+    node_executor *p_node_executor = (void *) 0;
+    node_batch *p_node_batch = (void *) 0;
+    size_t node_quantity = 0,
+           edge_quantity = 0;
+    uint64_t t[10] = { 0 };
+
+    // Generate the graph
+    if ( p_shape->pfn_generator(&_text, size) == 0 ) goto no_mem;
+
+    // Parse
+    t[0] = node_bench_now();
+    if ( json_value_parse(_text.p_data, 0, &p_value) == 0 ) goto failed_to_parse;
+
+    // Construct
+    t[1] = node_bench_now();
+    if ( node_graph_construct(&p_node_graph, p_value) == 0 ) goto failed_to_construct;
+
+    // Compile, which flattens nested graphs, then sorts
+    t[2] = node_bench_now();
+    if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+    t[3] = node_bench_now();
+
+    // Count the flattened graph, and give each node work to do
+    node_quantity = p_node_graph->node_quantity;
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[i];
+
+        // Count the connected inputs
+        for (size_t k = 0; k < p_node->in_quantity; k++) edge_quantity += ( p_node->in[k].p_in != (void *) 0 );
+
+        // Set the functions
+        p_node->pfn_function       = node_bench_function,
+        p_node->pfn_batch_function = node_bench_batch_function;
+    }
+
+    // Construct an executor, with a thread per processor, and a batch of one record
+    if ( node_executor_construct(&p_node_executor, 0, NODE_EXECUTOR_WORK_STEALING) == 0 ) goto failed_to_construct_executor;
+    if ( node_batch_construct(&p_node_batch, p_node_graph, 1) == 0 ) goto failed_to_construct_batch;
+
+    // Check the executor and the batch against a serial run
+    if ( node_bench_verify(p_node_graph, p_node_executor, p_node_batch) == 0 ) goto failed_to_verify;
+
+    // Execute
+    t[4] = node_bench_now();
+    if ( node_graph_execute(p_node_graph) == 0 ) goto failed_to_execute;
+
+    // Execute on the executor
+    t[5] = node_bench_now();
+    if ( node_executor_run(p_node_executor, p_node_graph) == 0 ) goto failed_to_execute;
+
+    // Execute as a batch
+    t[6] = node_bench_now();
+    if ( node_batch_run(p_node_batch, 1) == 0 ) goto failed_to_execute;
+    t[7] = node_bench_now();
+
+    // Release the executor and the batch
+    node_batch_destroy(&p_node_batch);
+    node_executor_destroy(&p_node_executor);
+
+    // Tear down
+    t[8] = node_bench_now();
+    node_graph_destroy(&p_node_graph);
+    json_value_free(p_value);
+    t[9] = node_bench_now();
+
+    // Report each phase
+    node_bench_report(p_shape->p_name, size, node_quantity, edge_quantity, "parse",     t[1] - t[0]);
+    node_bench_report(p_shape->p_name, size, node_quantity, edge_quantity, "construct", t[2] - t[1]);
+    node_bench_report(p_shape->p_name, size, node_quantity, edge_quantity, "compile",   t[3] - t[2]);
+    node_bench_report(p_shape->p_name, size, node_quantity, edge_quantity, "execute",   t[5] - t[4]);
+    node_bench_report(p_shape->p_name, size, node_quantity, edge_quantity, "executor",  t[6] - t[5]);
+    node_bench_report(p_shape->p_name, size, node_quantity, edge_quantity, "batch",     t[7] - t[6]);
+    node_bench_report(p_shape->p_name, size, node_quantity, edge_quantity, "teardown",  t[9] - t[8]);
+
+    // Release the text
+    free(_text.p_data);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Node errors
+        {
+            failed_to_parse:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to parse %s graph of %zu nodes in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to construct %s graph of %zu nodes in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to compile %s graph of %zu nodes in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_executor:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to construct executor for %s graph of %zu nodes in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_batch:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to construct batch for %s graph of %zu nodes in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_verify:
+                #ifndef NDEBUG
+                    log_error("[bench] Executor or batch of %s graph of %zu nodes does not match the serial run in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_execute:
+                #ifndef NDEBUG
+                    log_error("[bench] Failed to execute %s graph of %zu nodes in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to generate %s graph of %zu nodes in call to function \"%s\"\n", p_shape->p_name, size, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+// Entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // Initialized data
+    static const node_bench_shape shapes[] =
+    {
+        { "chain",   node_bench_chain   },
+        { "fan",     node_bench_fan     },
+        { "layered", node_bench_layered },
+        { "nested",  node_bench_nested  }
+    };
+    const size_t shape_quantity = sizeof(shapes) / sizeof(shapes[0]);
+    bool selected[sizeof(shapes) / sizeof(shapes[0])] = { 0 },
+         any_selected = false;
+    size_t min = 1000,
+           max = 10000000;
+    int result = EXIT_SUCCESS;
+
+    // Parse the arguments
+    for (int i = 1; i < argc; i++)
+    {
+
+        // Size bounds
+        if ( strcmp(argv[i], "--min") == 0 && i + 1 < argc ) { min = strtoull(argv[++i], 0, 10); continue; }
+        if ( strcmp(argv[i], "--max") == 0 && i + 1 < argc ) { max = strtoull(argv[++i], 0, 10); continue; }
+
+        // Shapes
+        for (size_t s = 0; s < shape_quantity; s++)
+            if ( strcmp(argv[i], shapes[s].p_name) == 0 ) { selected[s] = any_selected = true; goto next_argument; }
+
+        // Unknown argument
+        goto wrong_arguments;
+
+        next_argument:;
+    }
+
+    // Error check
+    if ( min == 0 || max < min ) goto wrong_arguments;
+
+    // Run every shape, unless some were named
+    if ( any_selected == false )
+        for (size_t s = 0; s < shape_quantity; s++) selected[s] = true;
+
+    // Run each case, from the smallest size up by powers of ten
+    for (size_t s = 0; s < shape_quantity; s++)
+    {
+
+        // Skip shapes that were not selected
+        if ( selected[s] == false ) continue;
+
+        for (size_t size = min; size <= max; size *= 10)
+        {
+
+            // Initialized data
+            pid_t pid = 0;
+            int status = 0;
+
+            // Flush, so the child does not repeat buffered output
+            fflush(stdout);
+
+            // Run the case in a process of its own
+            pid = fork();
+
+            // Error check
+            if ( pid < 0 ) goto failed_to_fork;
+
+            // Child
+            if ( pid == 0 )
+            {
+
+                // Initialized data
+                int ok = node_bench_run(&shapes[s], size);
+
+                // Flush the report
+                fflush(stdout);
+
+                // Done
+                _exit(( ok ) ? EXIT_SUCCESS : EXIT_FAILURE);
+            }
+
+            // Wait for the case
+            waitpid(pid, &status, 0);
+
+            // A case that fails, or runs out of memory, does not stop the others
+            if ( WIFEXITED(status) == false || WEXITSTATUS(status) != EXIT_SUCCESS )
+            {
+                #ifndef NDEBUG
+                    log_error("[bench] Case %s %zu did not finish\n", shapes[s].p_name, size);
+                #endif
+
+                // Report the failure when every case is done
+                result = EXIT_FAILURE;
+            }
+
+            // Stop before the size overflows
+            if ( size > SIZE_MAX / 10 ) break;
+        }
+    }
+
+    // Done
+    return result;
+
+    // Error handling
+    {
+
+        wrong_arguments:
+            fprintf(stderr, "Usage: %s [chain] [fan] [layered] [nested] [--min nodes] [--max nodes]\n", argv[0]);
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_fork:
+            #ifndef NDEBUG
+                log_error("[Standard Library] Failed to fork in call to function \"%s\"\n", __FUNCTION__);
+            #endif
+
+            // Error
+            return EXIT_FAILURE;
+    }
+}
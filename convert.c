@@ -0,0 +1,66 @@
+/** !
+ *  Convert a json node graph to a binary image
+ * 
+ * @file convert.c
+ * 
+ * @author Jacob Smith
+ */
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// node module
+#include <node/node.h>
+#include <node/image.h>
+
+// Entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // Argument check
+    if ( argc != 3 ) goto wrong_arguments;
+
+    // Initialized data
+    node_graph *p_node_graph = (void *) 0;
+
+    // Load a node graph
+    if ( node_graph_load(&p_node_graph, argv[1]) == 0 ) goto failed_to_load_graph;
+
+    // Write the image
+    if ( node_image_save(p_node_graph, argv[2]) == 0 ) { node_graph_destroy(&p_node_graph); goto failed_to_save_image; }
+
+    // Release the node graph
+    node_graph_destroy(&p_node_graph);
+    
+    // Success
+    return EXIT_SUCCESS;
+
+    // Error handling
+    {
+
+        wrong_arguments:
+            fprintf(stderr, "Usage: %s input.json output.image\n", argv[0]);
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_load_graph:
+            #ifndef NDEBUG
+                log_error("Error: Failed to load graph!\n");
+            #endif
+
+            // Error
+            return EXIT_FAILURE;
+
+        failed_to_save_image:
+            #ifndef NDEBUG
+                log_error("Error: Failed to save image!\n");
+            #endif
+
+            // Error
+            return EXIT_FAILURE;
+    }
+}
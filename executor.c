@@ -0,0 +1,755 @@
+/** !
+ * Node graph executor implementation
+ * 
+ * @file executor.c
+ * 
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/executor.h>
+
+// Preprocessor definitions
+#define NODE_EXECUTOR_EMPTY SIZE_MAX
+#define NODE_EXECUTOR_ABORT ( SIZE_MAX - 1 )
+
+// Function declarations
+/** !
+ * Queue a schedule entry on the shared queue
+ * 
+ * @param p_node_executor the executor
+ * @param entry           the position of the entry in the schedule
+ * 
+ * @return void
+ */
+void node_executor_push ( node_executor *const p_node_executor, size_t entry );
+
+/** !
+ * Wait for, and dequeue, a schedule entry from the shared queue
+ * 
+ * @param p_node_executor the executor
+ * 
+ * @return the position of the entry in the schedule, or SIZE_MAX to stop the worker
+ */
+size_t node_executor_pop ( node_executor *const p_node_executor );
+
+/** !
+ * Push a schedule entry onto the bottom of a worker's deque. Only the
+ * owner of the deque may call this while a run is in progress.
+ * 
+ * @param p_worker the worker
+ * @param entry    the position of the entry in the schedule
+ * 
+ * @return void
+ */
+void node_executor_deque_push ( node_executor_worker *const p_worker, size_t entry );
+
+/** !
+ * Pop a schedule entry from the bottom of a worker's deque. Only the
+ * owner of the deque may call this.
+ * 
+ * @param p_worker the worker
+ * 
+ * @return the position of the entry in the schedule, or NODE_EXECUTOR_EMPTY
+ */
+size_t node_executor_deque_pop ( node_executor_worker *const p_worker );
+
+/** !
+ * Steal a schedule entry from the top of a worker's deque
+ * 
+ * @param p_victim the worker to steal from
+ * 
+ * @return the position of the entry in the schedule, NODE_EXECUTOR_EMPTY, or NODE_EXECUTOR_ABORT if another thief won
+ */
+size_t node_executor_deque_steal ( node_executor_worker *const p_victim );
+
+/** !
+ * Run one schedule entry, and the entries fused after it, then release
+ * the successors of the last
+ * 
+ * @param p_worker the worker running the entry
+ * @param entry    the position of the entry in the schedule
+ * 
+ * @return void
+ */
+void node_executor_entry_run ( node_executor_worker *const p_worker, size_t entry );
+
+/** !
+ * Worker thread entry point
+ * 
+ * @param p_parameter the worker
+ * 
+ * @return null pointer
+ */
+void *node_executor_worker_main ( void *p_parameter );
+
+// Function definitions
+int node_executor_construct ( node_executor **const pp_node_executor, size_t thread_quantity, enum node_executor_mode_e mode )
+{
+
+    // Argument check
+    if ( pp_node_executor == (void *) 0 ) goto no_node_executor;
+    if ( mode >= NODE_EXECUTOR_MODE_QUANTITY ) goto wrong_mode;
+
+    // Initialized data
+    node_executor *p_node_executor = (void *) 0;
+    size_t started = 0;
+
+    // Default to one thread per online processor
+    if ( thread_quantity == 0 )
+    {
+
+        // Initialized data
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+        // Store the thread quantity
+        thread_quantity = ( processors > 0 ) ? (size_t) processors : 1;
+    }
+
+    // Allocate an executor
+    p_node_executor = NODE_REALLOC(0, sizeof(node_executor));
+
+    // Error check
+    if ( p_node_executor == (void *) 0 ) goto no_mem;
+
+    // Initialize memory
+    memset(p_node_executor, 0, sizeof(node_executor));
+
+    // Allocate the workers and a queue large enough to stop them
+    p_node_executor->mode             = mode;
+    p_node_executor->thread_quantity  = thread_quantity;
+    p_node_executor->p_workers        = NODE_REALLOC(0, thread_quantity * sizeof(node_executor_worker));
+    p_node_executor->queue.capacity   = thread_quantity;
+    p_node_executor->queue.p_entries  = NODE_REALLOC(0, thread_quantity * sizeof(size_t));
+
+    // Error check
+    if ( p_node_executor->p_workers       == (void *) 0 ) goto no_mem_executor;
+    if ( p_node_executor->queue.p_entries == (void *) 0 ) goto no_mem_executor;
+
+    // Initialize memory
+    memset(p_node_executor->p_workers, 0, thread_quantity * sizeof(node_executor_worker));
+
+    // Construct the synchronization primitives
+    if ( mutex_create(&p_node_executor->queue._lock)         == 0 ) goto failed_to_create_mutex;
+    if ( semaphore_create(&p_node_executor->queue._ready, 0) == 0 ) goto failed_to_create_ready;
+    if ( semaphore_create(&p_node_executor->run._start, 0)   == 0 ) goto failed_to_create_start;
+    if ( semaphore_create(&p_node_executor->run._done, 0)    == 0 ) goto failed_to_create_done;
+
+    // Start each worker
+    for (; started < thread_quantity; started++)
+    {
+
+        // Initialized data
+        node_executor_worker *p_worker = &p_node_executor->p_workers[started];
+
+        // Populate the worker
+        p_worker->p_node_executor = p_node_executor,
+        p_worker->index           = started,
+        p_worker->seed            = 0x9E3779B97F4A7C15ULL * ( started + 1 );
+
+        // Start the thread
+        if ( pthread_create(&p_worker->thread, 0, node_executor_worker_main, p_worker) ) goto failed_to_create_thread;
+    }
+
+    // Return a pointer to the caller
+    *pp_node_executor = p_node_executor;
+
+    // Success
+    return 1;
+
+    // Undo the construction, newest first
+    failed_to_create_thread:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to create thread in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Tell each started worker to stop, then wait for it
+        atomic_store(&p_node_executor->stopping, true);
+        for (size_t i = 0; i < started; i++)
+        {
+            if ( mode == NODE_EXECUTOR_SHARED_QUEUE ) node_executor_push(p_node_executor, SIZE_MAX);
+            else                                      semaphore_signal(&p_node_executor->run._start);
+        }
+        for (size_t i = 0; i < started; i++) pthread_join(p_node_executor->p_workers[i].thread, 0);
+
+        // Fall through
+        goto destroy_done;
+
+    destroy_done:
+        semaphore_destroy(&p_node_executor->run._done);
+
+        // Fall through
+        goto destroy_start;
+
+    failed_to_create_done:
+        #ifndef NDEBUG
+            log_error("[sync] Failed to create semaphore in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto destroy_start;
+
+    destroy_start:
+        semaphore_destroy(&p_node_executor->run._start);
+
+        // Fall through
+        goto destroy_ready;
+
+    failed_to_create_start:
+        #ifndef NDEBUG
+            log_error("[sync] Failed to create semaphore in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto destroy_ready;
+
+    destroy_ready:
+        semaphore_destroy(&p_node_executor->queue._ready);
+
+        // Fall through
+        goto destroy_lock;
+
+    failed_to_create_ready:
+        #ifndef NDEBUG
+            log_error("[sync] Failed to create semaphore in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto destroy_lock;
+
+    destroy_lock:
+        mutex_destroy(&p_node_executor->queue._lock);
+
+        // Fall through
+        goto release_executor;
+
+    failed_to_create_mutex:
+        #ifndef NDEBUG
+            log_error("[sync] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_executor;
+
+    no_mem_executor:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_executor;
+
+    release_executor:
+
+        // Release each deque a worker made
+        for (size_t i = 0; i < started; i++)
+            if ( p_node_executor->p_workers[i].deque.p_entries )
+                p_node_executor->p_workers[i].deque.p_entries = NODE_REALLOC(p_node_executor->p_workers[i].deque.p_entries, 0);
+
+        // Release memory
+        if ( p_node_executor->p_workers       ) p_node_executor->p_workers       = NODE_REALLOC(p_node_executor->p_workers, 0);
+        if ( p_node_executor->queue.p_entries ) p_node_executor->queue.p_entries = NODE_REALLOC(p_node_executor->queue.p_entries, 0);
+        p_node_executor = NODE_REALLOC(p_node_executor, 0);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_executor:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Null pointer provided for parameter \"pp_node_executor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_mode:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Parameter \"mode\" must be a valid executor mode in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_executor_push ( node_executor *const p_node_executor, size_t entry )
+{
+
+    // Lock
+    mutex_lock(&p_node_executor->queue._lock);
+
+    // Append the entry
+    p_node_executor->queue.p_entries[p_node_executor->queue.tail++ % p_node_executor->queue.capacity] = entry;
+
+    // Unlock
+    mutex_unlock(&p_node_executor->queue._lock);
+
+    // Wake a worker
+    semaphore_signal(&p_node_executor->queue._ready);
+
+    // Done
+    return;
+}
+
+size_t node_executor_pop ( node_executor *const p_node_executor )
+{
+
+    // Initialized data
+    size_t entry = 0;
+
+    // Wait for an entry
+    semaphore_wait(&p_node_executor->queue._ready);
+
+    // Lock
+    mutex_lock(&p_node_executor->queue._lock);
+
+    // Remove the entry
+    entry = p_node_executor->queue.p_entries[p_node_executor->queue.head++ % p_node_executor->queue.capacity];
+
+    // Unlock
+    mutex_unlock(&p_node_executor->queue._lock);
+
+    // Success
+    return entry;
+}
+
+void node_executor_deque_push ( node_executor_worker *const p_worker, size_t entry )
+{
+
+    // Initialized data
+    long long bottom = atomic_load_explicit(&p_worker->deque.bottom, memory_order_relaxed);
+
+    // Store the entry
+    atomic_store_explicit(&p_worker->deque.p_entries[(size_t) bottom & p_worker->deque.mask], entry, memory_order_relaxed);
+
+    // Publish the entry to thieves
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&p_worker->deque.bottom, bottom + 1, memory_order_relaxed);
+
+    // Done
+    return;
+}
+
+size_t node_executor_deque_pop ( node_executor_worker *const p_worker )
+{
+
+    // Initialized data
+    long long bottom = atomic_load_explicit(&p_worker->deque.bottom, memory_order_relaxed) - 1,
+              top    = 0;
+    size_t entry = NODE_EXECUTOR_EMPTY;
+
+    // Reserve the bottom entry before looking at the top
+    atomic_store_explicit(&p_worker->deque.bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&p_worker->deque.top, memory_order_relaxed);
+
+    // Empty deque
+    if ( top > bottom )
+    {
+
+        // Undo the reservation
+        atomic_store_explicit(&p_worker->deque.bottom, bottom + 1, memory_order_relaxed);
+
+        // Done
+        return NODE_EXECUTOR_EMPTY;
+    }
+
+    // Load the entry
+    entry = atomic_load_explicit(&p_worker->deque.p_entries[(size_t) bottom & p_worker->deque.mask], memory_order_relaxed);
+
+    // More than one entry, so no thief can race for this one
+    if ( top < bottom ) return entry;
+
+    // Last entry. Race any thieves for it
+    if ( atomic_compare_exchange_strong_explicit(&p_worker->deque.top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed) == false )
+        entry = NODE_EXECUTOR_EMPTY;
+
+    // The deque is empty either way
+    atomic_store_explicit(&p_worker->deque.bottom, bottom + 1, memory_order_relaxed);
+
+    // Done
+    return entry;
+}
+
+size_t node_executor_deque_steal ( node_executor_worker *const p_victim )
+{
+
+    // Initialized data
+    long long top    = atomic_load_explicit(&p_victim->deque.top, memory_order_acquire),
+              bottom = 0;
+    size_t entry = NODE_EXECUTOR_EMPTY;
+
+    // Order the load of the top before the load of the bottom
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&p_victim->deque.bottom, memory_order_acquire);
+
+    // Empty deque
+    if ( top >= bottom ) return NODE_EXECUTOR_EMPTY;
+
+    // Load the entry
+    entry = atomic_load_explicit(&p_victim->deque.p_entries[(size_t) top & p_victim->deque.mask], memory_order_relaxed);
+
+    // Claim the entry
+    if ( atomic_compare_exchange_strong_explicit(&p_victim->deque.top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed) == false )
+        return NODE_EXECUTOR_ABORT;
+
+    // Success
+    return entry;
+}
+
+void node_executor_entry_run ( node_executor_worker *const p_worker, size_t entry )
+{
+
+    // Initialized data
+    node_executor *const p_node_executor = p_worker->p_node_executor;
+    const node_schedule *const p_schedule = p_node_executor->run.p_schedule;
+    const node_schedule_entry *const p_entry = &p_schedule->p_entries[entry];
+    const size_t unit_quantity = p_entry->fused_quantity + 1;
+    const node_schedule_entry *const p_last = &p_entry[p_entry->fused_quantity];
+    const size_t *const p_successors = &p_schedule->p_successors[p_last->successor_offset];
+
+    // Run the node, and any fused after it, unless an earlier node failed
+    for (size_t i = 0; i < unit_quantity; i++)
+        if ( atomic_load_explicit(&p_node_executor->run.failed, memory_order_relaxed) == false )
+            if ( node_graph_entry_run(p_node_executor->run.p_node_graph, &p_entry[i]) == 0 ) atomic_store(&p_node_executor->run.failed, true);
+
+    // Queue each successor whose last dependency this was. In work 
+    // stealing mode, it stays on this worker, next to its inputs
+    for (size_t i = 0; i < p_last->successor_quantity; i++)
+    {
+
+        // Skip successors that are still waiting on other inputs
+        if ( atomic_fetch_sub(&p_node_executor->run.p_counters[p_successors[i]], 1) != 1 ) continue;
+
+        // Queue the successor
+        if ( p_node_executor->mode == NODE_EXECUTOR_WORK_STEALING ) node_executor_deque_push(p_worker, p_successors[i]);
+        else                                                        node_executor_push(p_node_executor, p_successors[i]);
+    }
+
+    // In shared queue mode, signal the caller after the last entry
+    if ( atomic_fetch_sub(&p_node_executor->run.remaining, unit_quantity) == unit_quantity )
+        if ( p_node_executor->mode == NODE_EXECUTOR_SHARED_QUEUE ) semaphore_signal(&p_node_executor->run._done);
+
+    // Done
+    return;
+}
+
+void *node_executor_worker_main ( void *p_parameter )
+{
+
+    // Initialized data
+    node_executor_worker *p_worker = p_parameter;
+    node_executor *p_node_executor = p_worker->p_node_executor;
+    size_t thread_quantity = p_node_executor->thread_quantity;
+
+    // Shared queue mode
+    if ( p_node_executor->mode == NODE_EXECUTOR_SHARED_QUEUE )
+    {
+
+        // Run entries until told to stop
+        for (size_t entry = node_executor_pop(p_node_executor); entry != SIZE_MAX; entry = node_executor_pop(p_node_executor))
+            node_executor_entry_run(p_worker, entry);
+
+        // Done
+        return (void *) 0;
+    }
+
+    // Work stealing mode. Sleep between runs
+    for (;;)
+    {
+
+        // Wait for a run
+        semaphore_wait(&p_node_executor->run._start);
+
+        // State check
+        if ( atomic_load(&p_node_executor->stopping) ) break;
+
+        // Work until every entry of the run is done
+        while ( atomic_load_explicit(&p_node_executor->run.remaining, memory_order_acquire) )
+        {
+
+            // Initialized data
+            size_t entry = node_executor_deque_pop(p_worker);
+
+            // Steal from random victims when the deque is empty
+            for (size_t attempt = 0; entry >= NODE_EXECUTOR_ABORT && attempt < 2 * thread_quantity; attempt++)
+            {
+
+                // Advance the xorshift state
+                p_worker->seed ^= p_worker->seed << 13,
+                p_worker->seed ^= p_worker->seed >> 7,
+                p_worker->seed ^= p_worker->seed << 17;
+
+                // Try a victim
+                entry = node_executor_deque_steal(&p_node_executor->p_workers[p_worker->seed % thread_quantity]);
+            }
+
+            // Run the entry, or back off
+            if ( entry < NODE_EXECUTOR_ABORT ) node_executor_entry_run(p_worker, entry);
+            else                               sched_yield();
+        }
+
+        // The last worker out of the run wakes the caller
+        if ( atomic_fetch_sub(&p_node_executor->run.active, 1) == 1 ) semaphore_signal(&p_node_executor->run._done);
+    }
+
+    // Done
+    return (void *) 0;
+}
+
+int node_executor_run ( node_executor *const p_node_executor, node_graph *const p_node_graph )
+{
+
+    // Argument check
+    if ( p_node_executor == (void *) 0 ) goto no_node_executor;
+    if ( p_node_graph    == (void *) 0 ) goto no_node_graph;
+
+    // Compile the node graph on first use
+    if ( p_node_graph->p_schedule == (void *) 0 )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // A buffer plan that aliases outputs follows schedule order, which a parallel run does not
+    if ( p_node_graph->p_plan && p_node_graph->p_plan->arena_size < p_node_graph->p_plan->unaliased_size ) goto aliased;
+
+    // Initialized data
+    const node_schedule *const p_schedule = p_node_graph->p_schedule;
+    size_t entry_quantity = p_schedule->entry_quantity;
+
+    // Edge case
+    if ( entry_quantity == 0 ) return 1;
+
+    // Grow the counters and the queues to fit the schedule
+    if ( p_node_executor->run.counter_capacity < entry_quantity )
+    {
+
+        // Initialized data
+        size_t deque_capacity = 16;
+        atomic_size_t *p_counters = NODE_REALLOC(p_node_executor->run.p_counters, entry_quantity * sizeof(atomic_size_t));
+        size_t *p_entries = NODE_REALLOC(p_node_executor->queue.p_entries, ( entry_quantity + p_node_executor->thread_quantity ) * sizeof(size_t));
+
+        // Error check
+        if ( p_counters == (void *) 0 ) goto no_mem;
+        if ( p_entries  == (void *) 0 ) goto no_mem;
+
+        // Store the allocations
+        p_node_executor->run.p_counters       = p_counters,
+        p_node_executor->run.counter_capacity = entry_quantity,
+        p_node_executor->queue.p_entries      = p_entries,
+        p_node_executor->queue.capacity       = entry_quantity + p_node_executor->thread_quantity;
+
+        // Each entry is pushed once per run, so a deque never holds more than the schedule
+        while ( deque_capacity < entry_quantity ) deque_capacity <<= 1;
+
+        // Grow each deque
+        if ( p_node_executor->mode == NODE_EXECUTOR_WORK_STEALING )
+        {
+            for (size_t i = 0; i < p_node_executor->thread_quantity; i++)
+            {
+
+                // Initialized data
+                node_executor_worker *p_worker = &p_node_executor->p_workers[i];
+                atomic_size_t *p_deque_entries = NODE_REALLOC(p_worker->deque.p_entries, deque_capacity * sizeof(atomic_size_t));
+
+                // Error check
+                if ( p_deque_entries == (void *) 0 ) goto no_mem;
+
+                // Store the allocation
+                p_worker->deque.p_entries = p_deque_entries,
+                p_worker->deque.mask      = deque_capacity - 1;
+            }
+        }
+    }
+
+    // Load the dependency counters
+    for (size_t i = 0; i < entry_quantity; i++)
+        atomic_init(&p_node_executor->run.p_counters[i], p_schedule->p_entries[i].predecessor_quantity);
+
+    // Prepare the run
+    p_node_executor->run.p_node_graph = p_node_graph,
+    p_node_executor->run.p_schedule   = p_schedule;
+    atomic_store(&p_node_executor->run.remaining, entry_quantity);
+    atomic_store(&p_node_executor->run.failed, false);
+
+    // Shared queue mode. Queue each entry with no predecessors
+    if ( p_node_executor->mode == NODE_EXECUTOR_SHARED_QUEUE )
+    {
+        for (size_t i = 0; i < entry_quantity; i++)
+            if ( p_schedule->p_entries[i].predecessor_quantity == 0 ) node_executor_push(p_node_executor, i);
+    }
+
+    // Work stealing mode. Deal the entries with no predecessors across 
+    // the deques while the workers are asleep, then wake them
+    else
+    {
+
+        // Empty each deque
+        for (size_t i = 0; i < p_node_executor->thread_quantity; i++)
+            atomic_store(&p_node_executor->p_workers[i].deque.top, 0),
+            atomic_store(&p_node_executor->p_workers[i].deque.bottom, 0);
+
+        // Deal the sources round robin
+        for (size_t i = 0, j = 0; i < entry_quantity; i++)
+            if ( p_schedule->p_entries[i].predecessor_quantity == 0 ) 
+                node_executor_deque_push(&p_node_executor->p_workers[j++ % p_node_executor->thread_quantity], i);
+
+        // Every worker takes part in the run
+        atomic_store(&p_node_executor->run.active, p_node_executor->thread_quantity);
+
+        // Wake each worker
+        for (size_t i = 0; i < p_node_executor->thread_quantity; i++) semaphore_signal(&p_node_executor->run._start);
+    }
+
+    // Wait for the run to finish
+    semaphore_wait(&p_node_executor->run._done);
+
+    // Error check
+    if ( atomic_load(&p_node_executor->run.failed) ) goto failed_to_execute_node;
+
+    // Every node is up to date
+    for (size_t i = 0; i < p_node_graph->dirty.quantity; i++) p_node_graph->dirty.pp_nodes[i]->dirty = false;
+    p_node_graph->dirty.quantity = 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_executor:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Null pointer provided for parameter \"p_node_executor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_execute_node:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Node function returned an error in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            aliased:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Node graph has a buffer plan that aliases outputs, and must run in schedule order, in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_executor_destroy ( node_executor **const pp_node_executor )
+{
+
+    // Argument check
+    if ( pp_node_executor  == (void *) 0 ) goto no_node_executor;
+    if ( *pp_node_executor == (void *) 0 ) goto no_node_executor;
+
+    // Initialized data
+    node_executor *p_node_executor = *pp_node_executor;
+
+    // No more pointer for caller
+    *pp_node_executor = (void *) 0;
+
+    // Tell each worker to stop
+    atomic_store(&p_node_executor->stopping, true);
+    for (size_t i = 0; i < p_node_executor->thread_quantity; i++)
+    {
+        if ( p_node_executor->mode == NODE_EXECUTOR_SHARED_QUEUE ) node_executor_push(p_node_executor, SIZE_MAX);
+        else                                                       semaphore_signal(&p_node_executor->run._start);
+    }
+
+    // Wait for each worker
+    for (size_t i = 0; i < p_node_executor->thread_quantity; i++) pthread_join(p_node_executor->p_workers[i].thread, 0);
+
+    // Destroy the synchronization primitives
+    mutex_destroy(&p_node_executor->queue._lock);
+    semaphore_destroy(&p_node_executor->queue._ready);
+    semaphore_destroy(&p_node_executor->run._start);
+    semaphore_destroy(&p_node_executor->run._done);
+
+    // Release each deque
+    for (size_t i = 0; i < p_node_executor->thread_quantity; i++)
+        if ( p_node_executor->p_workers[i].deque.p_entries ) 
+            p_node_executor->p_workers[i].deque.p_entries = NODE_REALLOC(p_node_executor->p_workers[i].deque.p_entries, 0);
+
+    // Release memory
+    p_node_executor->p_workers       = NODE_REALLOC(p_node_executor->p_workers, 0);
+    p_node_executor->queue.p_entries = NODE_REALLOC(p_node_executor->queue.p_entries, 0);
+    if ( p_node_executor->run.p_counters ) p_node_executor->run.p_counters = NODE_REALLOC(p_node_executor->run.p_counters, 0);
+    p_node_executor                  = NODE_REALLOC(p_node_executor, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_executor:
+                #ifndef NDEBUG
+                    log_error("[node] [executor] Null pointer provided for parameter \"pp_node_executor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,676 @@
+/** !
+ * Export of node graphs to Graphviz DOT and json
+ *
+ * @file export.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/export.h>
+
+// Standard library
+#include <math.h>
+
+// Preprocessor definitions
+#define NODE_EXPORT_LITERAL(p_export, text) node_export_write((p_export), (text), sizeof(text) - 1)
+
+// Structure declarations
+struct node_export_s;
+
+// Type definitions
+typedef struct node_export_s node_export;
+
+// Structure definitions
+/** !
+ * The state of an export. Text is formatted into data; with a file, it
+ * is written out each time it fills, and without one, it grows.
+ */
+struct node_export_s
+{
+    FILE *p_file;
+    char *p_data;
+    size_t size;
+    size_t capacity;
+};
+
+// Function definitions
+int node_export_flush ( node_export *const p_export )
+{
+
+    // Write the text
+    if ( p_export->size )
+        if ( fwrite(p_export->p_data, 1, p_export->size, p_export->p_file) != p_export->size ) goto failed_to_write;
+
+    // Empty the buffer
+    p_export->size = 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            failed_to_write:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to write file in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_export_reserve ( node_export *const p_export, size_t size )
+{
+
+    // Initialized data
+    size_t capacity = ( p_export->capacity ) ? p_export->capacity : NODE_EXPORT_BUFFER_SIZE;
+    char *p_data = (void *) 0;
+
+    // Fast exit
+    if ( p_export->capacity - p_export->size >= size ) return 1;
+
+    // Make room by writing the text out
+    if ( p_export->p_file && p_export->size )
+    {
+        if ( node_export_flush(p_export) == 0 ) return 0;
+        if ( p_export->capacity >= size ) return 1;
+    }
+
+    // Grow the buffer
+    while ( capacity - p_export->size < size ) capacity *= 2;
+    p_data = NODE_REALLOC(p_export->p_data, capacity);
+
+    // Error check
+    if ( p_data == (void *) 0 ) goto no_mem;
+
+    // Store the allocation
+    p_export->p_data   = p_data,
+    p_export->capacity = capacity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_export_write ( node_export *const p_export, const char *const p_text, size_t size )
+{
+
+    // Make room
+    if ( node_export_reserve(p_export, size) == 0 ) return 0;
+
+    // Copy the text
+    memcpy(p_export->p_data + p_export->size, p_text, size);
+    p_export->size += size;
+
+    // Success
+    return 1;
+}
+
+int node_export_unsigned ( node_export *const p_export, unsigned long long value )
+{
+
+    // Initialized data
+    char _digits[24];
+    size_t i = sizeof(_digits);
+
+    // Format the digits, last first
+    do { _digits[--i] = (char) ( '0' + value % 10 ); value /= 10; } while ( value );
+
+    // Write the digits
+    return node_export_write(p_export, _digits + i, sizeof(_digits) - i);
+}
+
+int node_export_escape ( node_export *const p_export, const char *p_text, const char *const p_special, bool json )
+{
+
+    // Escape the text
+    while ( *p_text )
+    {
+
+        // Initialized data
+        const char *p_run = p_text;
+        unsigned char c = 0;
+
+        // Find a run of plain characters
+        while ( ( c = (unsigned char) *p_text ) >= 0x20 && strchr(p_special, c) == (void *) 0 ) p_text++;
+
+        // Copy the run
+        if ( node_export_write(p_export, p_run, (size_t) ( p_text - p_run )) == 0 ) return 0;
+
+        // Done
+        if ( c == '\0' ) break;
+
+        // Escape the character
+        if ( c >= 0x20 )
+        {
+            if ( node_export_write(p_export, "\\", 1) == 0 ) return 0;
+            if ( node_export_write(p_export, p_text, 1) == 0 ) return 0;
+        }
+
+        // Control characters are not in DOT
+        else if ( json == false )
+        {
+            if ( node_export_write(p_export, " ", 1) == 0 ) return 0;
+        }
+
+        // Control characters
+        else
+        {
+
+            // Initialized data
+            const char _hex[] = "0123456789abcdef";
+            char _escape[6] = { '\\', 'u', '0', '0', _hex[c >> 4], _hex[c & 0xf] };
+
+            // Write the escape
+            if ( node_export_write(p_export, _escape, sizeof(_escape)) == 0 ) return 0;
+        }
+
+        // Next
+        p_text++;
+    }
+
+    // Success
+    return 1;
+}
+
+int node_export_string ( node_export *const p_export, const char *const p_text )
+{
+
+    // Write a json string
+    return node_export_write(p_export, "\"", 1) &&
+           node_export_escape(p_export, p_text, "\"\\", true) &&
+           node_export_write(p_export, "\"", 1);
+}
+
+int node_export_key_compare ( const void *const p_a, const void *const p_b )
+{
+
+    // Order the keys of an object
+    return strcmp(*(const char *const *) p_a, *(const char *const *) p_b);
+}
+
+int node_export_json_value ( node_export *const p_export, const json_value *const p_value )
+{
+
+    // Strategy
+    switch ( p_value->type )
+    {
+        case JSON_VALUE_BOOLEAN:
+            return ( p_value->boolean ) ? NODE_EXPORT_LITERAL(p_export, "true") : NODE_EXPORT_LITERAL(p_export, "false");
+
+        case JSON_VALUE_INTEGER:
+
+            // Sign
+            if ( p_value->integer < 0 )
+                return node_export_write(p_export, "-", 1) &&
+                       node_export_unsigned(p_export, 0ULL - (unsigned long long) p_value->integer);
+
+            // Done
+            return node_export_unsigned(p_export, (unsigned long long) p_value->integer);
+
+        case JSON_VALUE_NUMBER:
+        {
+
+            // Initialized data
+            char _text[32];
+            int length = 0;
+
+            // Numbers json can not hold are null
+            if ( isfinite(p_value->number) == 0 ) return NODE_EXPORT_LITERAL(p_export, "null");
+
+            // Format the number, so that it reads back the same
+            length = snprintf(_text, sizeof(_text), "%.17g", p_value->number);
+
+            // Write the number. A whole number keeps a fraction, so that it reads back as a number
+            return node_export_write(p_export, _text, (size_t) length) &&
+                   ( strpbrk(_text, ".e") || NODE_EXPORT_LITERAL(p_export, ".0") );
+        }
+
+        case JSON_VALUE_STRING:
+            return node_export_string(p_export, p_value->string);
+
+        case JSON_VALUE_ARRAY:
+        {
+
+            // Initialized data
+            size_t quantity = array_size(p_value->list);
+
+            // Opening bracket
+            if ( node_export_write(p_export, "[", 1) == 0 ) return 0;
+
+            // Write the elements in order
+            for (size_t i = 0; i < quantity; i++)
+            {
+
+                // Initialized data
+                json_value *p_element = (void *) 0;
+
+                // Store the element
+                array_index(p_value->list, (signed long long) i, (void **) &p_element);
+
+                // Write the element
+                if ( i ) if ( node_export_write(p_export, ",", 1) == 0 ) return 0;
+                if ( node_export_json_value(p_export, p_element) == 0 ) return 0;
+            }
+
+            // Closing bracket
+            return node_export_write(p_export, "]", 1);
+        }
+
+        case JSON_VALUE_OBJECT:
+        {
+
+            // Initialized data
+            size_t quantity = dict_keys(p_value->object, 0);
+            const char **pp_keys = ( quantity ) ? NODE_REALLOC(0, quantity * sizeof(const char *)) : (void *) 0;
+            int result = 1;
+
+            // Error check
+            if ( quantity && pp_keys == (void *) 0 ) goto no_mem;
+
+            // Sort the keys
+            if ( quantity ) dict_keys(p_value->object, pp_keys);
+            if ( quantity ) qsort(pp_keys, quantity, sizeof(const char *), node_export_key_compare);
+
+            // Write the properties
+            result = node_export_write(p_export, "{", 1);
+            for (size_t i = 0; result && i < quantity; i++)
+                result = ( i == 0 || node_export_write(p_export, ",", 1) ) &&
+                         node_export_string(p_export, pp_keys[i]) &&
+                         node_export_write(p_export, ":", 1) &&
+                         node_export_json_value(p_export, dict_get(p_value->object, pp_keys[i]));
+            result = result && node_export_write(p_export, "}", 1);
+
+            // Release memory
+            if ( pp_keys ) pp_keys = NODE_REALLOC(pp_keys, 0);
+
+            // Done
+            return result;
+        }
+
+        default:
+            return NODE_EXPORT_LITERAL(p_export, "null");
+    }
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_export_json_port ( node_export *const p_export, const char *const p_name, const node_port_type *const p_type )
+{
+
+    // A port with a type
+    if ( p_type )
+        return node_export_write(p_export, "{", 1) &&
+               node_export_string(p_export, p_name) &&
+               node_export_write(p_export, ":", 1) &&
+               node_export_string(p_export, p_type->p_name) &&
+               node_export_write(p_export, "}", 1);
+
+    // A port
+    return node_export_string(p_export, p_name);
+}
+
+int node_export_json ( node_export *const p_export, const node_graph *const p_node_graph )
+{
+
+    // Begin the nodes
+    if ( NODE_EXPORT_LITERAL(p_export, "{\n\"nodes\":{") == 0 ) return 0;
+
+    // Write each node
+    for (size_t i = 0; i < p_node_graph->node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+        bool first = true;
+
+        // Write the name
+        if ( node_export_write(p_export, ( i ) ? ",\n" : "\n", ( i ) ? 2 : 1) == 0 ) return 0;
+        if ( node_export_string(p_export, p_node->p_name) == 0 ) return 0;
+        if ( NODE_EXPORT_LITERAL(p_export, ":{") == 0 ) return 0;
+
+        // Write the inputs
+        if ( p_node->in_quantity )
+        {
+            if ( NODE_EXPORT_LITERAL(p_export, "\"in\":[") == 0 ) return 0;
+            for (size_t k = 0; k < p_node->in_quantity; k++)
+                if ( ( k && node_export_write(p_export, ",", 1) == 0 ) || node_export_json_port(p_export, p_node->in[k].p_name, p_node->in[k].p_type) == 0 ) return 0;
+            if ( node_export_write(p_export, "]", 1) == 0 ) return 0;
+            first = false;
+        }
+
+        // Write the outputs
+        if ( p_node->out_quantity )
+        {
+            if ( first == false ) if ( node_export_write(p_export, ",", 1) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, "\"out\":[") == 0 ) return 0;
+            for (size_t j = 0; j < p_node->out_quantity; j++)
+                if ( ( j && node_export_write(p_export, ",", 1) == 0 ) || node_export_json_port(p_export, p_node->out[j].p_name, p_node->out[j].p_type) == 0 ) return 0;
+            if ( node_export_write(p_export, "]", 1) == 0 ) return 0;
+            first = false;
+        }
+
+        // Write the kind
+        if ( p_node->p_kind )
+        {
+            if ( first == false ) if ( node_export_write(p_export, ",", 1) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, "\"kind\":") == 0 ) return 0;
+            if ( node_export_string(p_export, p_node->p_kind->p_name) == 0 ) return 0;
+            first = false;
+        }
+
+        // Write the node data
+        if ( p_node->value )
+        {
+            if ( first == false ) if ( node_export_write(p_export, ",", 1) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, "\"data\":") == 0 ) return 0;
+            if ( node_export_json_value(p_export, p_node->value) == 0 ) return 0;
+        }
+
+        // End the node
+        if ( node_export_write(p_export, "}", 1) == 0 ) return 0;
+    }
+
+    // Begin the connections
+    if ( NODE_EXPORT_LITERAL(p_export, "\n},\n\"connections\":[") == 0 ) return 0;
+
+    // Write the connection of each input
+    for (size_t i = 0, c = 0; i < p_node_graph->node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+
+        // Each input
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            const node *p_in = p_node->in[k].p_in;
+
+            // Skip unconnected inputs
+            if ( p_in == (void *) 0 ) continue;
+
+            // Write the connection
+            if ( node_export_write(p_export, ( c ) ? ",\n[\"" : "\n[\"", ( c ) ? 4 : 3) == 0 ) return 0;
+            c++;
+            if ( node_export_escape(p_export, p_in->p_name, "\"\\", true) == 0 ) return 0;
+            if ( node_export_write(p_export, ":", 1) == 0 ) return 0;
+            if ( node_export_escape(p_export, p_in->out[p_node->in[k].out_index].p_name, "\"\\", true) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, "\",\"") == 0 ) return 0;
+            if ( node_export_escape(p_export, p_node->p_name, "\"\\", true) == 0 ) return 0;
+            if ( node_export_write(p_export, ":", 1) == 0 ) return 0;
+            if ( node_export_escape(p_export, p_node->in[k].p_name, "\"\\", true) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, "\"]") == 0 ) return 0;
+        }
+    }
+
+    // End the graph
+    return NODE_EXPORT_LITERAL(p_export, "\n]\n}\n");
+}
+
+int node_export_dot ( node_export *const p_export, const node_graph *const p_node_graph )
+{
+
+    // Begin the graph
+    if ( NODE_EXPORT_LITERAL(p_export, "digraph {\n    rankdir=LR;\n    node [shape=record];\n") == 0 ) return 0;
+
+    // Write each node as a record of its inputs, its name and its outputs
+    for (size_t i = 0; i < p_node_graph->node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+
+        // Begin the node
+        if ( NODE_EXPORT_LITERAL(p_export, "    n") == 0 ) return 0;
+        if ( node_export_unsigned(p_export, p_node->index) == 0 ) return 0;
+        if ( NODE_EXPORT_LITERAL(p_export, " [label=\"{") == 0 ) return 0;
+
+        // Write the inputs
+        if ( p_node->in_quantity )
+        {
+            if ( node_export_write(p_export, "{", 1) == 0 ) return 0;
+            for (size_t k = 0; k < p_node->in_quantity; k++)
+            {
+                if ( node_export_write(p_export, ( k ) ? "|<i" : "<i", ( k ) ? 3 : 2) == 0 ) return 0;
+                if ( node_export_unsigned(p_export, k) == 0 ) return 0;
+                if ( NODE_EXPORT_LITERAL(p_export, "> ") == 0 ) return 0;
+                if ( node_export_escape(p_export, p_node->in[k].p_name, "\"\\{}|<>", false) == 0 ) return 0;
+            }
+            if ( NODE_EXPORT_LITERAL(p_export, "}|") == 0 ) return 0;
+        }
+
+        // Write the name
+        if ( node_export_escape(p_export, p_node->p_name, "\"\\{}|<>", false) == 0 ) return 0;
+
+        // Write the outputs
+        if ( p_node->out_quantity )
+        {
+            if ( NODE_EXPORT_LITERAL(p_export, "|{") == 0 ) return 0;
+            for (size_t j = 0; j < p_node->out_quantity; j++)
+            {
+                if ( node_export_write(p_export, ( j ) ? "|<o" : "<o", ( j ) ? 3 : 2) == 0 ) return 0;
+                if ( node_export_unsigned(p_export, j) == 0 ) return 0;
+                if ( NODE_EXPORT_LITERAL(p_export, "> ") == 0 ) return 0;
+                if ( node_export_escape(p_export, p_node->out[j].p_name, "\"\\{}|<>", false) == 0 ) return 0;
+            }
+            if ( node_export_write(p_export, "}", 1) == 0 ) return 0;
+        }
+
+        // End the node
+        if ( NODE_EXPORT_LITERAL(p_export, "}\"];\n") == 0 ) return 0;
+    }
+
+    // Write the connection of each input as an edge
+    for (size_t i = 0; i < p_node_graph->node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+
+        // Each input
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Skip unconnected inputs
+            if ( p_node->in[k].p_in == (void *) 0 ) continue;
+
+            // Write the edge
+            if ( NODE_EXPORT_LITERAL(p_export, "    n") == 0 ) return 0;
+            if ( node_export_unsigned(p_export, p_node->in[k].p_in->index) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, ":o") == 0 ) return 0;
+            if ( node_export_unsigned(p_export, p_node->in[k].out_index) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, " -> n") == 0 ) return 0;
+            if ( node_export_unsigned(p_export, p_node->index) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, ":i") == 0 ) return 0;
+            if ( node_export_unsigned(p_export, k) == 0 ) return 0;
+            if ( NODE_EXPORT_LITERAL(p_export, ";\n") == 0 ) return 0;
+        }
+    }
+
+    // End the graph
+    return NODE_EXPORT_LITERAL(p_export, "}\n");
+}
+
+int node_export_format ( node_export *const p_export, const node_graph *const p_node_graph, enum node_export_format_e format )
+{
+
+    // Strategy
+    switch ( format )
+    {
+        case NODE_EXPORT_DOT:
+            return node_export_dot(p_export, p_node_graph);
+
+        case NODE_EXPORT_JSON:
+            return node_export_json(p_export, p_node_graph);
+
+        default:
+            goto unknown_format;
+    }
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            unknown_format:
+                #ifndef NDEBUG
+                    log_error("[node] [export] Unknown format %d in call to function \"%s\"\n", (int) format, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_export ( const node_graph *const p_node_graph, enum node_export_format_e format, FILE *const p_file )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_file       == (void *) 0 ) goto no_file;
+
+    // Initialized data
+    node_export _export = { .p_file = p_file };
+    int result = 0;
+
+    // Format the graph, and write out the rest of the text
+    result = node_export_format(&_export, p_node_graph, format) &&
+             node_export_flush(&_export);
+
+    // Release the buffer
+    if ( _export.p_data ) _export.p_data = NODE_REALLOC(_export.p_data, 0);
+
+    // Error check
+    if ( result == 0 ) goto failed_to_export;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [export] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_file:
+                #ifndef NDEBUG
+                    log_error("[node] [export] Null pointer provided for parameter \"p_file\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_export:
+                #ifndef NDEBUG
+                    log_error("[node] [export] Failed to export node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_export_text ( const node_graph *const p_node_graph, enum node_export_format_e format, char **const pp_text, size_t *const p_size )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( pp_text      == (void *) 0 ) goto no_text;
+
+    // Initialized data
+    node_export _export = { 0 };
+
+    // Format the graph, and terminate the text
+    if ( node_export_format(&_export, p_node_graph, format) == 0 ) goto failed_to_export;
+    if ( node_export_write(&_export, "", 1) == 0 ) goto failed_to_export;
+
+    // Return the text to the caller
+    *pp_text = _export.p_data;
+    if ( p_size ) *p_size = _export.size - 1;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [export] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_text:
+                #ifndef NDEBUG
+                    log_error("[node] [export] Null pointer provided for parameter \"pp_text\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_export:
+                #ifndef NDEBUG
+                    log_error("[node] [export] Failed to export node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the buffer
+                if ( _export.p_data ) _export.p_data = NODE_REALLOC(_export.p_data, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,928 @@
+/** !
+ * Node data expressions
+ *
+ * @file expression.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/expression.h>
+
+// Standard library
+#include <ctype.h>
+#include <math.h>
+
+// Structure declarations
+struct node_expression_operand_s;
+struct node_expression_compiler_s;
+
+// Type definitions
+typedef struct node_expression_operand_s node_expression_operand;
+typedef struct node_expression_compiler_s node_expression_compiler;
+
+// Structure definitions
+/** !
+ * A parsed operand. Constants stay out of registers until an instruction
+ * needs them, so that constant subexpressions fold.
+ */
+struct node_expression_operand_s
+{
+    bool constant;
+    double value;
+    size_t reg;
+};
+
+/** !
+ * The state of one compile. Temporaries are allocated like a stack; the
+ * live ones always belong to the operands that are still being parsed.
+ */
+struct node_expression_compiler_s
+{
+    const char *p_text;
+    const char *p;
+    const char *const *pp_inputs;
+    size_t input_quantity;
+    bool quiet;
+
+    size_t next, high;
+
+    size_t instruction_quantity, instruction_max;
+    node_expression_instruction *p_instructions;
+
+    size_t constant_quantity, constant_max;
+    double *p_constants;
+};
+
+// Function definitions
+double node_expression_apply ( enum node_expression_op_e op, double a, double b )
+{
+
+    // Compute the operation
+    switch ( op )
+    {
+        case NODE_EXPRESSION_ADD:      return a + b;
+        case NODE_EXPRESSION_SUBTRACT: return a - b;
+        case NODE_EXPRESSION_MULTIPLY: return a * b;
+        case NODE_EXPRESSION_DIVIDE:   return a / b;
+        case NODE_EXPRESSION_MIN:      return ( a < b ) ? a : b;
+        case NODE_EXPRESSION_MAX:      return ( a > b ) ? a : b;
+        case NODE_EXPRESSION_NEGATE:   return -a;
+        case NODE_EXPRESSION_ABS:      return fabs(a);
+        case NODE_EXPRESSION_SQRT:     return sqrt(a);
+        default:                       return 0.0;
+    }
+}
+
+int node_expression_syntax_error ( node_expression_compiler *p_compiler, const char *const p_message )
+{
+
+    // Report the error, unless the caller is only probing
+    #ifndef NDEBUG
+        if ( p_compiler->quiet == false )
+            log_error("[node] [expression] %s at column %zu of \"%s\"\n", p_message, (size_t) ( p_compiler->p - p_compiler->p_text ) + 1, p_compiler->p_text);
+    #else
+        (void) p_compiler, (void) p_message;
+    #endif
+
+    // Error
+    return 0;
+}
+
+void node_expression_skip ( node_expression_compiler *p_compiler )
+{
+
+    // Skip whitespace
+    while ( isspace((unsigned char) *p_compiler->p) ) p_compiler->p++;
+}
+
+int node_expression_emit ( node_expression_compiler *p_compiler, enum node_expression_op_e op, size_t result, size_t a, size_t b )
+{
+
+    // Grow the instructions
+    if ( p_compiler->instruction_quantity == p_compiler->instruction_max )
+    {
+
+        // Initialized data
+        size_t max = ( p_compiler->instruction_max ) ? p_compiler->instruction_max * 2 : 16;
+        node_expression_instruction *p_instructions = NODE_REALLOC(p_compiler->p_instructions, max * sizeof(node_expression_instruction));
+
+        // Error check
+        if ( p_instructions == (void *) 0 ) return 0;
+
+        // Store the instructions
+        p_compiler->p_instructions  = p_instructions,
+        p_compiler->instruction_max = max;
+    }
+
+    // Store the instruction
+    p_compiler->p_instructions[p_compiler->instruction_quantity++] = (node_expression_instruction)
+    {
+        .op     = (uint8_t) op,
+        .result = (uint8_t) result,
+        .a      = (uint8_t) a,
+        .b      = (uint8_t) b
+    };
+
+    // Success
+    return 1;
+}
+
+int node_expression_allocate ( node_expression_compiler *p_compiler, size_t *p_reg )
+{
+
+    // Error check
+    if ( p_compiler->next == NODE_EXPRESSION_REGISTER_QUANTITY ) return node_expression_syntax_error(p_compiler, "Out of registers");
+
+    // Take the next temporary
+    *p_reg = p_compiler->next++;
+
+    // Track the most registers in use
+    if ( p_compiler->next > p_compiler->high ) p_compiler->high = p_compiler->next;
+
+    // Success
+    return 1;
+}
+
+void node_expression_release ( node_expression_compiler *p_compiler, const node_expression_operand *p_a, const node_expression_operand *p_b )
+{
+
+    // Initialized data
+    size_t temporaries = (size_t) ( p_a && p_a->constant == false && p_a->reg >= p_compiler->input_quantity )
+                       + (size_t) ( p_b && p_b->constant == false && p_b->reg >= p_compiler->input_quantity );
+
+    // The temporaries of the operands are the top of the stack
+    p_compiler->next -= temporaries;
+}
+
+int node_expression_materialize ( node_expression_compiler *p_compiler, node_expression_operand *p_operand )
+{
+
+    // Inputs and temporaries are already in registers
+    if ( p_operand->constant == false ) return 1;
+
+    // Error check
+    if ( p_compiler->constant_quantity == 65536 ) return node_expression_syntax_error(p_compiler, "Too many constants");
+
+    // Grow the constants
+    if ( p_compiler->constant_quantity == p_compiler->constant_max )
+    {
+
+        // Initialized data
+        size_t max = ( p_compiler->constant_max ) ? p_compiler->constant_max * 2 : 8;
+        double *p_constants = NODE_REALLOC(p_compiler->p_constants, max * sizeof(double));
+
+        // Error check
+        if ( p_constants == (void *) 0 ) return 0;
+
+        // Store the constants
+        p_compiler->p_constants  = p_constants,
+        p_compiler->constant_max = max;
+    }
+
+    // Load the constant into a temporary
+    if ( node_expression_allocate(p_compiler, &p_operand->reg) == 0 ) return 0;
+    if ( node_expression_emit(p_compiler, NODE_EXPRESSION_CONSTANT, p_operand->reg, p_compiler->constant_quantity & 0xff, p_compiler->constant_quantity >> 8) == 0 ) return 0;
+
+    // Store the constant
+    p_compiler->p_constants[p_compiler->constant_quantity++] = p_operand->value;
+    p_operand->constant = false;
+
+    // Success
+    return 1;
+}
+
+int node_expression_combine ( node_expression_compiler *p_compiler, enum node_expression_op_e op, node_expression_operand *p_a, node_expression_operand *p_b )
+{
+
+    // Fold constants
+    if ( p_a->constant && ( p_b == (void *) 0 || p_b->constant ) )
+    {
+        p_a->value = node_expression_apply(op, p_a->value, ( p_b ) ? p_b->value : 0.0);
+
+        // Success
+        return 1;
+    }
+
+    // Load the operands
+    if ( node_expression_materialize(p_compiler, p_a) == 0 ) return 0;
+    if ( p_b && node_expression_materialize(p_compiler, p_b) == 0 ) return 0;
+
+    // Free their temporaries, and write the result to the lowest free register
+    node_expression_release(p_compiler, p_a, p_b);
+
+    // Initialized data
+    size_t a = p_a->reg,
+           b = ( p_b ) ? p_b->reg : p_a->reg;
+
+    // Emit the instruction
+    if ( node_expression_allocate(p_compiler, &p_a->reg) == 0 ) return 0;
+    if ( node_expression_emit(p_compiler, op, p_a->reg, a, b) == 0 ) return 0;
+
+    // Success
+    return 1;
+}
+
+int node_expression_parse_sum ( node_expression_compiler *p_compiler, node_expression_operand *p_result );
+
+int node_expression_parse_primary ( node_expression_compiler *p_compiler, node_expression_operand *p_result )
+{
+
+    // Skip whitespace
+    node_expression_skip(p_compiler);
+
+    // A parenthesized expression
+    if ( *p_compiler->p == '(' )
+    {
+        p_compiler->p++;
+
+        // Parse the expression
+        if ( node_expression_parse_sum(p_compiler, p_result) == 0 ) return 0;
+
+        // Skip whitespace
+        node_expression_skip(p_compiler);
+
+        // Error check
+        if ( *p_compiler->p != ')' ) return node_expression_syntax_error(p_compiler, "Expected \")\"");
+
+        // Advance the cursor
+        p_compiler->p++;
+
+        // Success
+        return 1;
+    }
+
+    // A number
+    if ( isdigit((unsigned char) *p_compiler->p) || *p_compiler->p == '.' )
+    {
+
+        // Initialized data
+        char *p_end = (void *) 0;
+        double value = strtod(p_compiler->p, &p_end);
+
+        // Error check
+        if ( p_end == p_compiler->p ) return node_expression_syntax_error(p_compiler, "Expected a number");
+
+        // Store the constant
+        *p_result = (node_expression_operand) { .constant = true, .value = value };
+
+        // Advance the cursor
+        p_compiler->p = p_end;
+
+        // Success
+        return 1;
+    }
+
+    // An input, or a function
+    if ( isalpha((unsigned char) *p_compiler->p) || *p_compiler->p == '_' )
+    {
+
+        // Initialized data
+        const char *p_start = p_compiler->p;
+        size_t length = 0;
+
+        // Find the end of the name
+        while ( isalnum((unsigned char) *p_compiler->p) || *p_compiler->p == '_' ) p_compiler->p++;
+
+        // Compute the length of the name
+        length = (size_t) ( p_compiler->p - p_start );
+
+        // Skip whitespace
+        node_expression_skip(p_compiler);
+
+        // A function
+        if ( *p_compiler->p == '(' )
+        {
+
+            // Initialized data
+            static const struct { const char *p_name; enum node_expression_op_e op; size_t arguments; } _functions[] =
+            {
+                { "min",  NODE_EXPRESSION_MIN,  2 },
+                { "max",  NODE_EXPRESSION_MAX,  2 },
+                { "abs",  NODE_EXPRESSION_ABS,  1 },
+                { "sqrt", NODE_EXPRESSION_SQRT, 1 }
+            };
+            node_expression_operand b = { 0 };
+
+            for (size_t i = 0; i < sizeof(_functions) / sizeof(*_functions); i++)
+            {
+
+                // Skip functions with another name
+                if ( strncmp(_functions[i].p_name, p_start, length) || _functions[i].p_name[length] ) continue;
+
+                // Parse the first argument
+                p_compiler->p++;
+                if ( node_expression_parse_sum(p_compiler, p_result) == 0 ) return 0;
+
+                // Parse the second argument
+                if ( _functions[i].arguments == 2 )
+                {
+
+                    // Skip whitespace
+                    node_expression_skip(p_compiler);
+
+                    // Error check
+                    if ( *p_compiler->p != ',' ) return node_expression_syntax_error(p_compiler, "Expected \",\"");
+
+                    // Parse the argument
+                    p_compiler->p++;
+                    if ( node_expression_parse_sum(p_compiler, &b) == 0 ) return 0;
+                }
+
+                // Skip whitespace
+                node_expression_skip(p_compiler);
+
+                // Error check
+                if ( *p_compiler->p != ')' ) return node_expression_syntax_error(p_compiler, "Expected \")\"");
+
+                // Advance the cursor
+                p_compiler->p++;
+
+                // Apply the function
+                return node_expression_combine(p_compiler, _functions[i].op, p_result, ( _functions[i].arguments == 2 ) ? &b : (void *) 0);
+            }
+
+            // Unknown function
+            p_compiler->p = p_start;
+
+            // Error
+            return node_expression_syntax_error(p_compiler, "Unknown function");
+        }
+
+        // Resolve the input to its register
+        for (size_t i = 0; i < p_compiler->input_quantity; i++)
+        {
+
+            // Skip inputs with another name
+            if ( strncmp(p_compiler->pp_inputs[i], p_start, length) || p_compiler->pp_inputs[i][length] ) continue;
+
+            // Store the input
+            *p_result = (node_expression_operand) { .constant = false, .reg = i };
+
+            // Success
+            return 1;
+        }
+
+        // Unknown input
+        p_compiler->p = p_start;
+
+        // Error
+        return node_expression_syntax_error(p_compiler, "Unknown input");
+    }
+
+    // Error
+    return node_expression_syntax_error(p_compiler, ( *p_compiler->p ) ? "Unexpected character" : "Unexpected end of expression");
+}
+
+int node_expression_parse_unary ( node_expression_compiler *p_compiler, node_expression_operand *p_result )
+{
+
+    // Skip whitespace
+    node_expression_skip(p_compiler);
+
+    // Unary plus
+    if ( *p_compiler->p == '+' ) return p_compiler->p++, node_expression_parse_unary(p_compiler, p_result);
+
+    // Unary minus
+    if ( *p_compiler->p == '-' )
+    {
+        p_compiler->p++;
+
+        // Parse the operand
+        if ( node_expression_parse_unary(p_compiler, p_result) == 0 ) return 0;
+
+        // Negate it
+        return node_expression_combine(p_compiler, NODE_EXPRESSION_NEGATE, p_result, (void *) 0);
+    }
+
+    // Parse the operand
+    return node_expression_parse_primary(p_compiler, p_result);
+}
+
+int node_expression_parse_product ( node_expression_compiler *p_compiler, node_expression_operand *p_result )
+{
+
+    // Parse the first factor
+    if ( node_expression_parse_unary(p_compiler, p_result) == 0 ) return 0;
+
+    // Parse the rest
+    for (;;)
+    {
+
+        // Initialized data
+        node_expression_operand b = { 0 };
+        enum node_expression_op_e op = NODE_EXPRESSION_MULTIPLY;
+
+        // Skip whitespace
+        node_expression_skip(p_compiler);
+
+        // Parse the operator
+        if      ( *p_compiler->p == '*' ) op = NODE_EXPRESSION_MULTIPLY;
+        else if ( *p_compiler->p == '/' ) op = NODE_EXPRESSION_DIVIDE;
+        else return 1;
+
+        // Parse the factor
+        p_compiler->p++;
+        if ( node_expression_parse_unary(p_compiler, &b) == 0 ) return 0;
+
+        // Combine the factors
+        if ( node_expression_combine(p_compiler, op, p_result, &b) == 0 ) return 0;
+    }
+}
+
+int node_expression_parse_sum ( node_expression_compiler *p_compiler, node_expression_operand *p_result )
+{
+
+    // Parse the first term
+    if ( node_expression_parse_product(p_compiler, p_result) == 0 ) return 0;
+
+    // Parse the rest
+    for (;;)
+    {
+
+        // Initialized data
+        node_expression_operand b = { 0 };
+        enum node_expression_op_e op = NODE_EXPRESSION_ADD;
+
+        // Skip whitespace
+        node_expression_skip(p_compiler);
+
+        // Parse the operator
+        if      ( *p_compiler->p == '+' ) op = NODE_EXPRESSION_ADD;
+        else if ( *p_compiler->p == '-' ) op = NODE_EXPRESSION_SUBTRACT;
+        else return 1;
+
+        // Parse the term
+        p_compiler->p++;
+        if ( node_expression_parse_product(p_compiler, &b) == 0 ) return 0;
+
+        // Combine the terms
+        if ( node_expression_combine(p_compiler, op, p_result, &b) == 0 ) return 0;
+    }
+}
+
+int node_expression_allocate_expression ( node_expression **const pp_node_expression, size_t constant_quantity, size_t instruction_quantity )
+{
+
+    // Initialized data
+    node_expression *p_node_expression = NODE_REALLOC(0, sizeof(node_expression) + constant_quantity * sizeof(double) + instruction_quantity * sizeof(node_expression_instruction));
+
+    // Error check
+    if ( p_node_expression == (void *) 0 ) return 0;
+
+    // Populate the expression. The instructions follow the constants
+    *p_node_expression = (node_expression)
+    {
+        .constant_quantity    = constant_quantity,
+        .instruction_quantity = instruction_quantity,
+        .p_instructions       = (node_expression_instruction *) &p_node_expression->_constants[constant_quantity]
+    };
+
+    // Return a pointer to the caller
+    *pp_node_expression = p_node_expression;
+
+    // Success
+    return 1;
+}
+
+int node_expression_compile_text ( node_expression **const pp_node_expression, const char *const p_text, const char *const *const pp_inputs, size_t input_quantity, bool quiet )
+{
+
+    // Initialized data
+    node_expression_compiler _compiler =
+    {
+        .p_text         = p_text,
+        .p              = p_text,
+        .pp_inputs      = pp_inputs,
+        .input_quantity = input_quantity,
+        .quiet          = quiet,
+        .next           = input_quantity,
+        .high           = input_quantity
+    };
+    node_expression_operand result = { 0 };
+    node_expression *p_node_expression = (void *) 0;
+
+    // Parse the expression
+    if ( node_expression_parse_sum(&_compiler, &result) == 0 ) goto failed_to_parse;
+
+    // Skip whitespace
+    node_expression_skip(&_compiler);
+
+    // The expression must end here
+    if ( *_compiler.p )
+    {
+        node_expression_syntax_error(&_compiler, "Unexpected character");
+        goto failed_to_parse;
+    }
+
+    // A constant expression still needs a register to hold its value
+    if ( node_expression_materialize(&_compiler, &result) == 0 ) goto failed_to_parse;
+
+    // Allocate the expression
+    if ( node_expression_allocate_expression(&p_node_expression, _compiler.constant_quantity, _compiler.instruction_quantity) == 0 ) goto no_mem;
+
+    // Populate the expression
+    p_node_expression->input_quantity    = input_quantity,
+    p_node_expression->register_quantity = _compiler.high,
+    p_node_expression->result            = result.reg;
+
+    // Copy the constants and the instructions
+    if ( _compiler.constant_quantity    ) memcpy(p_node_expression->_constants, _compiler.p_constants, _compiler.constant_quantity * sizeof(double));
+    if ( _compiler.instruction_quantity ) memcpy(p_node_expression->p_instructions, _compiler.p_instructions, _compiler.instruction_quantity * sizeof(node_expression_instruction));
+
+    // Release the scratch
+    if ( _compiler.p_constants    ) _compiler.p_constants    = NODE_REALLOC(_compiler.p_constants, 0);
+    if ( _compiler.p_instructions ) _compiler.p_instructions = NODE_REALLOC(_compiler.p_instructions, 0);
+
+    // Return a pointer to the caller
+    *pp_node_expression = p_node_expression;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Expression errors
+        {
+            failed_to_parse:
+
+                // Release the scratch
+                if ( _compiler.p_constants    ) _compiler.p_constants    = NODE_REALLOC(_compiler.p_constants, 0);
+                if ( _compiler.p_instructions ) _compiler.p_instructions = NODE_REALLOC(_compiler.p_instructions, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the scratch
+                if ( _compiler.p_constants    ) _compiler.p_constants    = NODE_REALLOC(_compiler.p_constants, 0);
+                if ( _compiler.p_instructions ) _compiler.p_instructions = NODE_REALLOC(_compiler.p_instructions, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_expression_compile ( node_expression **const pp_node_expression, const char *const p_text, const char *const *const pp_inputs, size_t input_quantity )
+{
+
+    // Argument check
+    if ( pp_node_expression == (void *) 0                      ) goto no_node_expression;
+    if ( p_text             == (void *) 0                      ) goto no_text;
+    if ( pp_inputs == (void *) 0 && input_quantity             ) goto no_inputs;
+    if ( input_quantity > NODE_EXPRESSION_REGISTER_QUANTITY    ) goto too_many_inputs;
+
+    // Compile the expression
+    return node_expression_compile_text(pp_node_expression, p_text, pp_inputs, input_quantity, false);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_expression:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"pp_node_expression\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_text:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"p_text\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_inputs:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"pp_inputs\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            too_many_inputs:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Parameter \"input_quantity\" must not exceed %d in call to function \"%s\"\n", NODE_EXPRESSION_REGISTER_QUANTITY, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_expression_node_compile ( node_expression **const pp_node_expression, const node *const p_node )
+{
+
+    // Argument check
+    if ( pp_node_expression == (void *) 0 ) goto no_node_expression;
+    if ( p_node             == (void *) 0 ) goto no_node;
+
+    // Initialized data
+    const json_value *p_value = p_node->value;
+    const char *_inputs[NODE_EXPRESSION_REGISTER_QUANTITY] = { 0 };
+
+    // Only string data can hold an expression. Other strings are not
+    // errors, so they are compiled quietly
+    if ( p_value == (void *) 0 || p_value->type != JSON_VALUE_STRING ) return 0;
+    if ( p_node->in_quantity > NODE_EXPRESSION_REGISTER_QUANTITY ) return 0;
+
+    // Gather the names of the inputs
+    for (size_t i = 0; i < p_node->in_quantity; i++) _inputs[i] = p_node->in[i].p_name;
+
+    // Compile the expression
+    return node_expression_compile_text(pp_node_expression, p_value->string, _inputs, p_node->in_quantity, true);
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_expression:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"pp_node_expression\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"p_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_expression_fuse ( node_expression **const pp_node_expression, const node_expression *const p_consumer, size_t input, const node_expression *const p_producer )
+{
+
+    // Argument check
+    if ( pp_node_expression == (void *) 0                  ) goto no_node_expression;
+    if ( p_consumer         == (void *) 0                  ) goto no_consumer;
+    if ( p_producer         == (void *) 0                  ) goto no_producer;
+    if ( input              >= p_consumer->input_quantity  ) goto no_input;
+
+    // Initialized data
+    node_expression *p_node_expression = (void *) 0;
+    size_t input_quantity        = p_consumer->input_quantity - 1 + p_producer->input_quantity,
+           producer_temporaries  = p_producer->register_quantity - p_producer->input_quantity,
+           consumer_temporaries  = p_consumer->register_quantity - p_consumer->input_quantity,
+           register_quantity     = input_quantity + producer_temporaries + consumer_temporaries,
+           constant_quantity     = p_producer->constant_quantity + p_consumer->constant_quantity;
+    uint8_t _producer[NODE_EXPRESSION_REGISTER_QUANTITY] = { 0 },
+            _consumer[NODE_EXPRESSION_REGISTER_QUANTITY] = { 0 };
+
+    // The fused expression must fit in the registers, and index its constants
+    if ( register_quantity > NODE_EXPRESSION_REGISTER_QUANTITY ) return 0;
+    if ( constant_quantity > 65536 ) return 0;
+
+    // Map the registers of the producer. Its inputs follow the inputs
+    // of the consumer, and its temporaries follow all the inputs
+    for (size_t r = 0; r < p_producer->register_quantity; r++)
+        _producer[r] = (uint8_t) ( ( r < p_producer->input_quantity ) ? p_consumer->input_quantity - 1 + r
+                                                                      : input_quantity + ( r - p_producer->input_quantity ) );
+
+    // Map the registers of the consumer. The fed input becomes the
+    // result of the producer, and its temporaries follow the producer's
+    for (size_t r = 0; r < p_consumer->register_quantity; r++)
+        _consumer[r] = (uint8_t) ( ( r == input                      ) ? _producer[p_producer->result]
+                                 : ( r <  input                      ) ? r
+                                 : ( r <  p_consumer->input_quantity ) ? r - 1
+                                 :                                       input_quantity + producer_temporaries + ( r - p_consumer->input_quantity ) );
+
+    // Allocate the expression
+    if ( node_expression_allocate_expression(&p_node_expression, constant_quantity, p_producer->instruction_quantity + p_consumer->instruction_quantity) == 0 ) goto no_mem;
+
+    // Populate the expression
+    p_node_expression->input_quantity    = input_quantity,
+    p_node_expression->register_quantity = register_quantity,
+    p_node_expression->result            = _consumer[p_consumer->result];
+
+    // Copy the constants. The consumer's follow the producer's
+    if ( p_producer->constant_quantity ) memcpy(p_node_expression->_constants, p_producer->_constants, p_producer->constant_quantity * sizeof(double));
+    if ( p_consumer->constant_quantity ) memcpy(p_node_expression->_constants + p_producer->constant_quantity, p_consumer->_constants, p_consumer->constant_quantity * sizeof(double));
+
+    // Copy the instructions of the producer, then the consumer
+    for (size_t i = 0; i < p_producer->instruction_quantity + p_consumer->instruction_quantity; i++)
+    {
+
+        // Initialized data
+        bool consumer = ( i >= p_producer->instruction_quantity );
+        node_expression_instruction instruction = ( consumer ) ? p_consumer->p_instructions[i - p_producer->instruction_quantity] : p_producer->p_instructions[i];
+        const uint8_t *p_map = ( consumer ) ? _consumer : _producer;
+
+        // Move constant indices past the producer's constants
+        if ( instruction.op == NODE_EXPRESSION_CONSTANT )
+        {
+
+            // Initialized data
+            size_t constant = ( (size_t) instruction.a | (size_t) instruction.b << 8 ) + ( ( consumer ) ? p_producer->constant_quantity : 0 );
+
+            // Store the index
+            instruction.a = (uint8_t) ( constant & 0xff ),
+            instruction.b = (uint8_t) ( constant >> 8 );
+        }
+
+        // Rename the registers
+        else
+            instruction.a = p_map[instruction.a],
+            instruction.b = p_map[instruction.b];
+
+        // Store the instruction
+        instruction.result = p_map[instruction.result];
+        p_node_expression->p_instructions[i] = instruction;
+    }
+
+    // Return a pointer to the caller
+    *pp_node_expression = p_node_expression;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_expression:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"pp_node_expression\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_consumer:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"p_consumer\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_producer:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"p_producer\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_input:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Parameter \"input\" is not an input of the consumer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_expression_evaluate ( const node_expression *const p_node_expression, const double *const p_inputs, double *const p_result )
+{
+
+    // Argument check
+    if ( p_node_expression == (void *) 0 ) goto no_node_expression;
+    if ( p_result          == (void *) 0 ) goto no_result;
+    if ( p_inputs == (void *) 0 && p_node_expression->input_quantity ) goto no_inputs;
+
+    // Initialized data
+    double _registers[NODE_EXPRESSION_REGISTER_QUANTITY];
+    const node_expression_instruction *p_instruction = p_node_expression->p_instructions,
+                                      *p_end         = p_instruction + p_node_expression->instruction_quantity;
+
+    // Load the inputs
+    if ( p_node_expression->input_quantity ) memcpy(_registers, p_inputs, p_node_expression->input_quantity * sizeof(double));
+
+    // Run the instructions
+    for (; p_instruction < p_end; p_instruction++)
+    {
+
+        // Load a constant. Its operands are an index, not registers
+        if ( p_instruction->op == NODE_EXPRESSION_CONSTANT )
+        {
+            _registers[p_instruction->result] = p_node_expression->_constants[(size_t) p_instruction->a | (size_t) p_instruction->b << 8];
+
+            continue;
+        }
+
+        // Initialized data
+        double a = _registers[p_instruction->a],
+               b = _registers[p_instruction->b];
+
+        // Compute the instruction
+        switch ( p_instruction->op )
+        {
+            case NODE_EXPRESSION_ADD:      _registers[p_instruction->result] = a + b;                  break;
+            case NODE_EXPRESSION_SUBTRACT: _registers[p_instruction->result] = a - b;                  break;
+            case NODE_EXPRESSION_MULTIPLY: _registers[p_instruction->result] = a * b;                  break;
+            case NODE_EXPRESSION_DIVIDE:   _registers[p_instruction->result] = a / b;                  break;
+            case NODE_EXPRESSION_MIN:      _registers[p_instruction->result] = ( a < b ) ? a : b;      break;
+            case NODE_EXPRESSION_MAX:      _registers[p_instruction->result] = ( a > b ) ? a : b;      break;
+            case NODE_EXPRESSION_NEGATE:   _registers[p_instruction->result] = -a;                     break;
+            case NODE_EXPRESSION_ABS:      _registers[p_instruction->result] = fabs(a);                break;
+            case NODE_EXPRESSION_SQRT:     _registers[p_instruction->result] = sqrt(a);                break;
+        }
+    }
+
+    // Return the result to the caller
+    *p_result = _registers[p_node_expression->result];
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_expression:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"p_node_expression\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_result:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"p_result\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_inputs:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"p_inputs\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_expression_destroy ( node_expression **const pp_node_expression )
+{
+
+    // Argument check
+    if ( pp_node_expression  == (void *) 0 ) goto no_node_expression;
+    if ( *pp_node_expression == (void *) 0 ) goto no_node_expression;
+
+    // Initialized data
+    node_expression *p_node_expression = *pp_node_expression;
+
+    // No more pointer for caller
+    *pp_node_expression = (void *) 0;
+
+    // Release the expression, with its constants and instructions
+    p_node_expression = NODE_REALLOC(p_node_expression, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_expression:
+                #ifndef NDEBUG
+                    log_error("[node] [expression] Null pointer provided for parameter \"pp_node_expression\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
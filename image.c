@@ -0,0 +1,1143 @@
+/** !
+ * Binary node graph image implementation
+ * 
+ * @file image.c
+ * 
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/image.h>
+
+// Structure declarations
+struct node_image_text_s;
+
+// Type definitions
+typedef struct node_image_text_s node_image_text;
+
+// Structure definitions
+struct node_image_text_s
+{
+    char *p_data;
+    size_t size;
+    size_t capacity;
+};
+
+// Function declarations
+/** !
+ * Append bytes to a text block
+ * 
+ * @param p_text   the text block
+ * @param p_bytes  the bytes
+ * @param size     the quantity of bytes
+ * 
+ * @return 1 on success, 0 on error
+ */
+int node_image_text_append ( node_image_text *const p_text, const void *const p_bytes, size_t size );
+
+/** !
+ * Append a nul terminated string to a text block
+ * 
+ * @param p_text   the text block
+ * @param p_string the string
+ * @param p_offset result; the offset of the string in the text block
+ * 
+ * @return 1 on success, 0 on error
+ */
+int node_image_text_string ( node_image_text *const p_text, const char *const p_string, uint64_t *const p_offset );
+
+/** !
+ * Append a json value to a text block, as json text
+ * 
+ * @param p_text  the text block
+ * @param p_value the json value
+ * 
+ * @return 1 on success, 0 on error
+ */
+int node_image_text_json ( node_image_text *const p_text, const json_value *const p_value );
+
+// Function definitions
+int node_image_text_append ( node_image_text *const p_text, const void *const p_bytes, size_t size )
+{
+
+    // Grow the text block
+    if ( p_text->size + size > p_text->capacity )
+    {
+
+        // Initialized data
+        size_t capacity = ( p_text->capacity ) ? p_text->capacity : 4096;
+        char *p_data = (void *) 0;
+
+        // Double until the bytes fit
+        while ( p_text->size + size > capacity ) capacity *= 2;
+
+        // Reallocate
+        p_data = NODE_REALLOC(p_text->p_data, capacity);
+
+        // Error check
+        if ( p_data == (void *) 0 ) goto no_mem;
+
+        // Store the allocation
+        p_text->p_data   = p_data,
+        p_text->capacity = capacity;
+    }
+
+    // Copy the bytes
+    memcpy(p_text->p_data + p_text->size, p_bytes, size);
+
+    // Advance the cursor
+    p_text->size += size;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_image_text_string ( node_image_text *const p_text, const char *const p_string, uint64_t *const p_offset )
+{
+
+    // Store the offset
+    *p_offset = p_text->size;
+
+    // Append the string and its terminator
+    return node_image_text_append(p_text, p_string, strlen(p_string) + 1);
+}
+
+int node_image_text_json ( node_image_text *const p_text, const json_value *const p_value )
+{
+
+    // Initialized data
+    char _number[64] = { 0 };
+    int len = 0;
+
+    // Strategy
+    switch ( p_value->type )
+    {
+        case JSON_VALUE_NULL:
+            return node_image_text_append(p_text, "null", 4);
+
+        case JSON_VALUE_BOOLEAN:
+            return ( p_value->boolean ) ? node_image_text_append(p_text, "true", 4) : node_image_text_append(p_text, "false", 5);
+
+        case JSON_VALUE_INTEGER:
+            len = snprintf(_number, sizeof(_number), "%lld", p_value->integer);
+            return node_image_text_append(p_text, _number, (size_t) len);
+
+        case JSON_VALUE_NUMBER:
+            len = snprintf(_number, sizeof(_number), "%.17g", p_value->number);
+            return node_image_text_append(p_text, _number, (size_t) len);
+
+        case JSON_VALUE_STRING:
+        {
+
+            // Opening quote
+            if ( node_image_text_append(p_text, "\"", 1) == 0 ) return 0;
+
+            // Escape quotes, backslashes and control characters
+            for (const char *p = p_value->string; *p; p++)
+            {
+                if      ( *p == '"' || *p == '\\' ) { char _escape[2] = { '\\', *p }; if ( node_image_text_append(p_text, _escape, 2) == 0 ) return 0; }
+                else if ( (unsigned char) *p < 0x20 ) { len = snprintf(_number, sizeof(_number), "\\u%04x", (unsigned) *p); if ( node_image_text_append(p_text, _number, (size_t) len) == 0 ) return 0; }
+                else if ( node_image_text_append(p_text, p, 1) == 0 ) return 0;
+            }
+
+            // Closing quote
+            return node_image_text_append(p_text, "\"", 1);
+        }
+
+        case JSON_VALUE_ARRAY:
+        {
+
+            // Initialized data
+            size_t quantity = array_size(p_value->list);
+
+            // Opening bracket
+            if ( node_image_text_append(p_text, "[", 1) == 0 ) return 0;
+
+            // Each element
+            for (size_t i = 0; i < quantity; i++)
+            {
+
+                // Initialized data
+                json_value *p_element = (void *) 0;
+
+                // Store the element
+                array_index(p_value->list, (signed long long) i, (void **) &p_element);
+
+                // Separator
+                if ( i ) if ( node_image_text_append(p_text, ",", 1) == 0 ) return 0;
+
+                // Element
+                if ( node_image_text_json(p_text, p_element) == 0 ) return 0;
+            }
+
+            // Closing bracket
+            return node_image_text_append(p_text, "]", 1);
+        }
+
+        case JSON_VALUE_OBJECT:
+        {
+
+            // Initialized data
+            size_t quantity = dict_keys(p_value->object, 0);
+            const char **pp_keys = ( quantity ) ? NODE_REALLOC(0, quantity * sizeof(const char *)) : (void *) 0;
+            int result = 1;
+
+            // Error check
+            if ( quantity && pp_keys == (void *) 0 ) return 0;
+
+            // Get the keys
+            if ( quantity ) dict_keys(p_value->object, pp_keys);
+
+            // Opening brace
+            result = node_image_text_append(p_text, "{", 1);
+
+            // Each property
+            for (size_t i = 0; result && i < quantity; i++)
+            {
+
+                // Initialized data
+                json_value _key = { .type = JSON_VALUE_STRING, .string = (char *) pp_keys[i] };
+
+                // Separator, key and value
+                if ( i ) result = node_image_text_append(p_text, ",", 1);
+                if ( result ) result = node_image_text_json(p_text, &_key);
+                if ( result ) result = node_image_text_append(p_text, ":", 1);
+                if ( result ) result = node_image_text_json(p_text, dict_get(p_value->object, pp_keys[i]));
+            }
+
+            // Closing brace
+            if ( result ) result = node_image_text_append(p_text, "}", 1);
+
+            // Release memory
+            if ( pp_keys ) pp_keys = NODE_REALLOC(pp_keys, 0);
+
+            // Done
+            return result;
+        }
+
+        default:
+            return 0;
+    }
+}
+
+int node_image_save ( node_graph *const p_node_graph, const char *const p_path )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_path       == (void *) 0 ) goto no_path;
+
+    // Compile the node graph on first use
+    if ( p_node_graph->p_schedule == (void *) 0 )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Initialized data
+    const node_schedule *const p_schedule = p_node_graph->p_schedule;
+    node_image_header _header = { ._magic = NODE_IMAGE_MAGIC, .version = NODE_IMAGE_VERSION, .endian = NODE_IMAGE_ENDIAN };
+    node_image_text _text = { 0 };
+    unsigned char *p_tables = (void *) 0;
+    node_image_node *p_nodes = (void *) 0;
+    node_image_input *p_inputs = (void *) 0;
+    node_image_output *p_outputs = (void *) 0;
+    node_image_entry *p_entries = (void *) 0;
+    uint64_t *p_successors = (void *) 0;
+    node_image_symbol *p_symbols = (void *) 0;
+    size_t tables_size = 0;
+    FILE *p_f = (void *) 0;
+
+    // Count the records
+    _header.node_quantity = p_node_graph->node_quantity;
+    _header.entry_quantity = p_schedule->entry_quantity;
+    _header.symbol_quantity = p_node_graph->symbols.quantity;
+    for (size_t i = 0; i < p_node_graph->node_quantity; i++)
+        _header.input_quantity  += p_node_graph->_p_nodes[i]->in_quantity,
+        _header.output_quantity += p_node_graph->_p_nodes[i]->out_quantity;
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+        _header.successor_quantity += p_schedule->p_entries[i].successor_quantity;
+
+    // Lay out the tables
+    _header.nodes      = sizeof(node_image_header);
+    _header.inputs     = _header.nodes      + ( _header.node_quantity      * sizeof(node_image_node) );
+    _header.outputs    = _header.inputs     + ( _header.input_quantity     * sizeof(node_image_input) );
+    _header.entries    = _header.outputs    + ( _header.output_quantity    * sizeof(node_image_output) );
+    _header.successors = _header.entries    + ( _header.entry_quantity     * sizeof(node_image_entry) );
+    _header.symbols    = _header.successors + ( _header.successor_quantity * sizeof(uint64_t) );
+    _header.text       = _header.symbols    + ( _header.symbol_quantity    * sizeof(node_image_symbol) );
+    tables_size        = _header.text - sizeof(node_image_header);
+
+    // Allocate the tables
+    p_tables = NODE_REALLOC(0, tables_size ? tables_size : 1);
+
+    // Error check
+    if ( p_tables == (void *) 0 ) goto no_mem;
+
+    // Carve the tables out of the allocation
+    p_nodes      = (node_image_node *)   (p_tables),
+    p_inputs     = (node_image_input *)  (p_tables + ( _header.inputs     - _header.nodes )),
+    p_outputs    = (node_image_output *) (p_tables + ( _header.outputs    - _header.nodes )),
+    p_entries    = (node_image_entry *)  (p_tables + ( _header.entries    - _header.nodes )),
+    p_successors = (uint64_t *)          (p_tables + ( _header.successors - _header.nodes )),
+    p_symbols    = (node_image_symbol *) (p_tables + ( _header.symbols    - _header.nodes ));
+
+    // Write each symbol, and its text. Nodes and ports refer to their names by id
+    for (size_t id = 0; id < _header.symbol_quantity; id++)
+    {
+
+        // Initialized data
+        const node_symbol *p_symbol = &p_node_graph->symbols.p_symbols[id];
+
+        // Populate the record
+        p_symbols[id] = (node_image_symbol)
+        {
+            .text   = _text.size,
+            .length = p_symbol->length,
+            .hash   = p_symbol->hash
+        };
+
+        // Text, and its terminator
+        if ( node_image_text_append(&_text, p_symbol->p_text, p_symbol->length) == 0 ) goto failed_to_write_text;
+        if ( node_image_text_append(&_text, "", 1)                             == 0 ) goto failed_to_write_text;
+    }
+
+    // Write each node, its ports, and its text
+    for (size_t i = 0, input = 0, output = 0; i < p_node_graph->node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *const p_node = p_node_graph->_p_nodes[i];
+        node_image_node *p_record = &p_nodes[i];
+
+        // Populate the record
+        *p_record = (node_image_node)
+        {
+            .id           = p_node->id,
+            .data         = NODE_IMAGE_NONE,
+            .kind         = NODE_IMAGE_NONE,
+            .input        = input,
+            .in_quantity  = p_node->in_quantity,
+            .output       = output,
+            .out_quantity = p_node->out_quantity
+        };
+
+        // Data
+        if ( p_node->value )
+        {
+            p_record->data = _text.size;
+            if ( node_image_text_json(&_text, p_node->value) == 0 ) goto failed_to_write_text;
+            if ( node_image_text_append(&_text, "", 1)       == 0 ) goto failed_to_write_text;
+        }
+
+        // Kind
+        if ( p_node->p_kind )
+            if ( node_image_text_string(&_text, p_node->p_kind->p_name, &p_record->kind) == 0 ) goto failed_to_write_text;
+
+        // Inputs
+        for (size_t k = 0; k < p_node->in_quantity; k++, input++)
+        {
+
+            // Link
+            p_inputs[input].node = ( p_node->in[k].p_in ) ? p_node->in[k].p_in->index : NODE_IMAGE_NONE,
+            p_inputs[input].port = ( p_node->in[k].p_in ) ? p_node->in[k].out_index   : NODE_IMAGE_NONE,
+            p_inputs[input].type = NODE_IMAGE_NONE,
+            p_inputs[input].id   = p_node->in[k].id;
+
+            // Type
+            if ( p_node->in[k].p_type )
+                if ( node_image_text_string(&_text, p_node->in[k].p_type->p_name, &p_inputs[input].type) == 0 ) goto failed_to_write_text;
+        }
+
+        // Outputs
+        for (size_t k = 0; k < p_node->out_quantity; k++, output++)
+        {
+
+            // Name, untyped
+            p_outputs[output].id   = p_node->out[k].id,
+            p_outputs[output].type = NODE_IMAGE_NONE;
+
+            // Type
+            if ( p_node->out[k].p_type )
+                if ( node_image_text_string(&_text, p_node->out[k].p_type->p_name, &p_outputs[output].type) == 0 ) goto failed_to_write_text;
+        }
+    }
+
+    // Write the schedule
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+        p_entries[i] = (node_image_entry)
+        {
+            .node                 = p_schedule->p_entries[i].index,
+            .predecessor_quantity = p_schedule->p_entries[i].predecessor_quantity,
+            .successor            = p_schedule->p_entries[i].successor_offset,
+            .successor_quantity   = p_schedule->p_entries[i].successor_quantity
+        };
+    for (size_t i = 0; i < _header.successor_quantity; i++) p_successors[i] = p_schedule->p_successors[i];
+
+    // Finish the header
+    _header.text_size = _text.size,
+    _header.size      = _header.text + _text.size;
+
+    // Open the file
+    p_f = fopen(p_path, "wb");
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
+
+    // Write the header, the tables, and the text
+    if ( fwrite(&_header, sizeof(_header), 1, p_f) != 1 ) goto failed_to_write_file;
+    if ( tables_size && fwrite(p_tables, tables_size, 1, p_f) != 1 ) goto failed_to_write_file;
+    if ( _text.size && fwrite(_text.p_data, _text.size, 1, p_f) != 1 ) goto failed_to_write_file;
+
+    // Close the file
+    if ( fclose(p_f) ) { p_f = (void *) 0; goto failed_to_write_file; }
+
+    // Release memory
+    p_tables = NODE_REALLOC(p_tables, 0);
+    if ( _text.p_data ) _text.p_data = NODE_REALLOC(_text.p_data, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_write_text:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Failed to write text in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                p_tables = NODE_REALLOC(p_tables, 0);
+                if ( _text.p_data ) _text.p_data = NODE_REALLOC(_text.p_data, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Release memory
+                p_tables = NODE_REALLOC(p_tables, 0);
+                if ( _text.p_data ) _text.p_data = NODE_REALLOC(_text.p_data, 0);
+
+                // Error
+                return 0;
+
+            failed_to_write_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to write file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Close the file
+                if ( p_f ) fclose(p_f);
+
+                // Release memory
+                p_tables = NODE_REALLOC(p_tables, 0);
+                if ( _text.p_data ) _text.p_data = NODE_REALLOC(_text.p_data, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_image_load ( node_image **const pp_node_image, const char *const p_path )
+{
+
+    // Argument check
+    if ( pp_node_image == (void *) 0 ) goto no_node_image;
+    if ( p_path        == (void *) 0 ) goto no_path;
+
+    // Initialized data
+    node_image *p_node_image = (void *) 0;
+    const node_image_header *p_header = (void *) 0;
+    struct stat _stat = { 0 };
+    void *p_base = (void *) 0;
+    size_t size = 0;
+    int fd = open(p_path, O_RDONLY);
+
+    // Error check
+    if ( fd == -1 ) goto failed_to_open_file;
+    if ( fstat(fd, &_stat) == -1 ) goto failed_to_stat_file;
+
+    // Store the size
+    size = (size_t) _stat.st_size;
+
+    // Error check
+    if ( size < sizeof(node_image_header) ) goto truncated;
+
+    // Map the file
+    p_base = mmap((void *) 0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping holds its own reference to the file
+    close(fd);
+
+    // Error check
+    if ( p_base == MAP_FAILED ) goto failed_to_map_file;
+
+    // Store the header
+    p_header = p_base;
+
+    // Check the header
+    if ( memcmp(p_header->_magic, NODE_IMAGE_MAGIC, sizeof(NODE_IMAGE_MAGIC)) ) goto wrong_magic;
+    if ( p_header->version != NODE_IMAGE_VERSION ) goto wrong_version;
+    if ( p_header->endian  != NODE_IMAGE_ENDIAN  ) goto wrong_endian;
+    if ( p_header->size    != size               ) goto corrupt;
+
+    // Check that each table is inside the file
+    if ( p_header->nodes      > size || ( size - p_header->nodes      ) / sizeof(node_image_node)   < p_header->node_quantity      ) goto corrupt;
+    if ( p_header->inputs     > size || ( size - p_header->inputs     ) / sizeof(node_image_input)  < p_header->input_quantity     ) goto corrupt;
+    if ( p_header->outputs    > size || ( size - p_header->outputs    ) / sizeof(node_image_output) < p_header->output_quantity    ) goto corrupt;
+    if ( p_header->entries    > size || ( size - p_header->entries    ) / sizeof(node_image_entry)  < p_header->entry_quantity     ) goto corrupt;
+    if ( p_header->successors > size || ( size - p_header->successors ) / sizeof(uint64_t)          < p_header->successor_quantity ) goto corrupt;
+    if ( p_header->symbols    > size || ( size - p_header->symbols    ) / sizeof(node_image_symbol) < p_header->symbol_quantity    ) goto corrupt;
+    if ( p_header->text       > size || ( size - p_header->text       )                             < p_header->text_size          ) goto corrupt;
+
+    // The text block must end with a terminator
+    if ( p_header->text_size && ((const char *) p_base)[p_header->text + p_header->text_size - 1] != '\0' ) goto corrupt;
+
+    // Allocate an image
+    p_node_image = NODE_REALLOC(0, sizeof(node_image));
+
+    // Error check
+    if ( p_node_image == (void *) 0 ) goto no_mem;
+
+    // Populate the image
+    *p_node_image = (node_image)
+    {
+        .p_base       = p_base,
+        .size         = size,
+        .p_header     = p_header,
+        .p_nodes      = (const node_image_node *)   ((const char *) p_base + p_header->nodes),
+        .p_inputs     = (const node_image_input *)  ((const char *) p_base + p_header->inputs),
+        .p_outputs    = (const node_image_output *) ((const char *) p_base + p_header->outputs),
+        .p_entries    = (const node_image_entry *)  ((const char *) p_base + p_header->entries),
+        .p_successors = (const uint64_t *)          ((const char *) p_base + p_header->successors),
+        .p_symbols    = (const node_image_symbol *) ((const char *) p_base + p_header->symbols),
+        .p_text       = (const char *) p_base + p_header->text
+    };
+
+    // Return a pointer to the caller
+    *pp_node_image = p_node_image;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_image:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Null pointer provided for parameter \"pp_node_image\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Image errors
+        {
+            truncated:
+                #ifndef NDEBUG
+                    log_error("[node] [image] File \"%s\" is too small to be an image in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Close the file
+                close(fd);
+
+                // Error
+                return 0;
+
+            wrong_magic:
+                #ifndef NDEBUG
+                    log_error("[node] [image] File \"%s\" is not an image in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Unmap the file
+                munmap(p_base, size);
+
+                // Error
+                return 0;
+
+            wrong_version:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Image \"%s\" has version %u, expected %u in call to function \"%s\"\n", p_path, p_header->version, NODE_IMAGE_VERSION, __FUNCTION__);
+                #endif
+
+                // Unmap the file
+                munmap(p_base, size);
+
+                // Error
+                return 0;
+
+            wrong_endian:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Image \"%s\" was written on a machine with a different byte order in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Unmap the file
+                munmap(p_base, size);
+
+                // Error
+                return 0;
+
+            corrupt:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Image \"%s\" is corrupt in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Unmap the file
+                munmap(p_base, size);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Unmap the file
+                munmap(p_base, size);
+
+                // Error
+                return 0;
+
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_stat_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to stat file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Close the file
+                close(fd);
+
+                // Error
+                return 0;
+
+            failed_to_map_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to map file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_image_graph_construct ( node_graph **const pp_node_graph, const node_image *const p_node_image )
+{
+
+    // Argument check
+    if ( pp_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_node_image  == (void *) 0 ) goto no_node_image;
+
+    // Initialized data
+    const node_image_header *const p_header = p_node_image->p_header;
+    node_graph *p_node_graph = (void *) 0;
+    node_schedule *p_schedule = (void *) 0;
+    const char *p_type_name = (void *) 0,
+               *p_kind_name = (void *) 0;
+    size_t node_quantity = p_header->node_quantity;
+
+    // Error check
+    if ( node_quantity == 0 ) goto no_nodes;
+    if ( p_header->entry_quantity != node_quantity ) goto corrupt;
+
+    // Allocate a node graph
+    if ( node_graph_create(&p_node_graph, node_quantity) == 0 ) goto failed_to_allocate_node_graph;
+
+    // Construct a symbol table with room for every name
+    if ( node_symbol_table_construct(&p_node_graph->symbols, p_header->symbol_quantity) == 0 ) goto failed_to_construct_symbol_table;
+
+    // Place each symbol by its stored hash. Ids are kept, and names are
+    // neither hashed nor compared, since the saved table had each once
+    for (size_t id = 0, mask = ( p_node_graph->symbols.capacity * 2 ) - 1; id < p_header->symbol_quantity; id++)
+    {
+
+        // Initialized data
+        const node_image_symbol *p_symbol = &p_node_image->p_symbols[id];
+        size_t i = p_symbol->hash & mask;
+
+        // Error check. The name and its terminator are in the text
+        if ( p_symbol->text >= p_header->text_size || p_header->text_size - p_symbol->text <= p_symbol->length ) goto corrupt;
+        if ( p_node_image->p_text[p_symbol->text + p_symbol->length] != '\0' ) goto corrupt;
+
+        // Store the symbol
+        p_node_graph->symbols.p_symbols[id] = (node_symbol)
+        {
+            .hash   = p_symbol->hash,
+            .p_text = p_node_image->p_text + p_symbol->text,
+            .length = p_symbol->length,
+            .p_node = (void *) 0
+        };
+
+        // Linear probe
+        while ( p_node_graph->symbols.p_slots[i] ) i = ( i + 1 ) & mask;
+
+        // Store the id
+        p_node_graph->symbols.p_slots[i] = id + 1;
+    }
+
+    // Store the quantity of symbols
+    p_node_graph->symbols.quantity = p_header->symbol_quantity;
+
+    // Construct each node. Names are not copied; they point into the image
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        const node_image_node *const p_record = &p_node_image->p_nodes[i];
+        node *p_node = (void *) 0;
+
+        // Error check
+        if ( p_record->id >= p_header->symbol_quantity ) goto corrupt;
+        if ( p_node_graph->symbols.p_symbols[p_record->id].p_node ) goto corrupt;
+        if ( p_record->input  > p_header->input_quantity  || p_header->input_quantity  - p_record->input  < p_record->in_quantity  ) goto corrupt;
+        if ( p_record->output > p_header->output_quantity || p_header->output_quantity - p_record->output < p_record->out_quantity ) goto corrupt;
+
+        // Allocate the node and its ports
+        if ( node_create(&p_node, &p_node_graph->arena, p_record->in_quantity, p_record->out_quantity, 0) == 0 ) goto failed_to_allocate_node;
+
+        // Populate the node
+        p_node->p_name = p_node_graph->symbols.p_symbols[p_record->id].p_text,
+        p_node->id     = p_record->id,
+        p_node->index  = i;
+
+        // Store the node in the node graph, and bind its symbol to it
+        p_node_graph->_p_nodes[i] = p_node,
+        p_node_graph->symbols.p_symbols[p_node->id].p_node = p_node;
+
+        // Error check
+        if ( p_record->data != NODE_IMAGE_NONE && p_record->data >= p_header->text_size ) goto corrupt;
+        if ( p_record->kind != NODE_IMAGE_NONE && p_record->kind >= p_header->text_size ) goto corrupt;
+
+        // Find the kind of the node data, and parse the data its kind constructs from
+        if ( p_record->kind != NODE_IMAGE_NONE )
+        {
+
+            // Find the kind
+            p_node->p_kind = node_data_kind_get(p_node_image->p_text + p_record->kind);
+
+            // Error check
+            if ( p_node->p_kind == (void *) 0 ) { p_kind_name = p_node_image->p_text + p_record->kind; goto unknown_kind; }
+
+            // Parse a copy of the data, since the image is read only
+            if ( p_record->data != NODE_IMAGE_NONE )
+            {
+
+                // Initialized data
+                const char *p_data = p_node_image->p_text + p_record->data;
+                size_t size = strlen(p_data) + 1;
+                char *p_copy = NODE_REALLOC(0, size);
+                json_value *p_value = (void *) 0;
+                int result = 0;
+
+                // Error check
+                if ( p_copy == (void *) 0 ) goto no_mem;
+
+                // Parse the copy
+                memcpy(p_copy, p_data, size);
+                result = json_value_parse(p_copy, 0, &p_value);
+                p_copy = NODE_REALLOC(p_copy, 0);
+
+                // Error check
+                if ( result == 0 ) goto corrupt;
+
+                // The node owns its data
+                p_node->value      = p_value,
+                p_node->owns_value = true;
+            }
+        }
+
+        // Name and type each port. A typed output holds a value of its type
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            const node_image_input *p_input = &p_node_image->p_inputs[p_record->input + k];
+
+            // Error check
+            if ( p_input->id >= p_header->symbol_quantity ) goto corrupt;
+            if ( p_input->type != NODE_IMAGE_NONE && p_input->type >= p_header->text_size ) goto corrupt;
+
+            // Store the name
+            p_node->in[k].p_name = p_node_graph->symbols.p_symbols[p_input->id].p_text,
+            p_node->in[k].id     = p_input->id;
+
+            // Untyped port
+            if ( p_input->type == NODE_IMAGE_NONE ) continue;
+
+            // Find the type
+            p_node->in[k].p_type = node_port_type_get(p_node_image->p_text + p_input->type);
+
+            // Error check
+            if ( p_node->in[k].p_type == (void *) 0 ) { p_type_name = p_node_image->p_text + p_input->type; goto unknown_port_type; }
+        }
+        for (size_t k = 0; k < p_node->out_quantity; k++)
+        {
+
+            // Initialized data
+            const node_image_output *p_output = &p_node_image->p_outputs[p_record->output + k];
+
+            // Error check
+            if ( p_output->id >= p_header->symbol_quantity ) goto corrupt;
+            if ( p_output->type != NODE_IMAGE_NONE && p_output->type >= p_header->text_size ) goto corrupt;
+
+            // Store the name
+            p_node->out[k].p_name = p_node_graph->symbols.p_symbols[p_output->id].p_text,
+            p_node->out[k].id     = p_output->id;
+
+            // Untyped port
+            if ( p_output->type == NODE_IMAGE_NONE ) continue;
+
+            // Find the type
+            p_node->out[k].p_type = node_port_type_get(p_node_image->p_text + p_output->type);
+
+            // Error check
+            if ( p_node->out[k].p_type == (void *) 0 ) { p_type_name = p_node_image->p_text + p_output->type; goto unknown_port_type; }
+
+            // Store the size of the value
+            p_node->out[k].size = p_node->out[k].p_type->size;
+        }
+    }
+
+    // Make each connection
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[i];
+        const node_image_input *p_inputs = &p_node_image->p_inputs[p_node_image->p_nodes[i].input];
+
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            node *p_in = (void *) 0;
+
+            // Unconnected input
+            if ( p_inputs[k].node == NODE_IMAGE_NONE ) continue;
+
+            // Error check
+            if ( p_inputs[k].node >= node_quantity ) goto corrupt;
+
+            // Store the node that feeds the input
+            p_in = p_node_graph->_p_nodes[p_inputs[k].node];
+
+            // Error check
+            if ( p_inputs[k].port >= p_in->out_quantity ) goto corrupt;
+
+            // Make the connection to the output
+            p_node->in[k].p_in      = p_in,
+            p_node->in[k].out_index = p_inputs[k].port;
+        }
+    }
+
+    // Construct the data of each node with a kind
+    if ( node_graph_data_construct(p_node_graph, 0) == 0 ) goto failed_to_construct_data;
+
+    // Give each typed output a slot in the value block
+    if ( node_graph_values_allocate(p_node_graph, 0) == 0 ) goto no_mem;
+
+    // Allocate the schedule in one block
+    p_schedule = NODE_REALLOC(0, sizeof(node_schedule) + 
+                                 ( node_quantity                * sizeof(node_schedule_entry) ) + 
+                                 ( p_header->input_quantity     * sizeof(node_output *) ) + 
+                                 ( p_header->successor_quantity * sizeof(size_t) ) );
+
+    // Error check
+    if ( p_schedule == (void *) 0 ) goto no_mem;
+
+    // Carve the arrays out of the allocation
+    *p_schedule = (node_schedule)
+    {
+        .entry_quantity = node_quantity,
+        .p_entries      = (node_schedule_entry *) (p_schedule + 1)
+    };
+    p_schedule->pp_inputs    = (node_output **) (p_schedule->p_entries + node_quantity),
+    p_schedule->p_successors = (size_t *) (p_schedule->pp_inputs + p_header->input_quantity);
+
+    // Hand the schedule to the graph, so it is released with the graph on error
+    p_node_graph->p_schedule = p_schedule;
+
+    // Copy the successors
+    for (size_t e = 0; e < p_header->successor_quantity; e++)
+    {
+
+        // Error check
+        if ( p_node_image->p_successors[e] >= node_quantity ) goto corrupt;
+
+        // Copy the successor
+        p_schedule->p_successors[e] = p_node_image->p_successors[e];
+    }
+
+    // Rebuild each entry, without sorting the graph again
+    for (size_t i = 0, input_offset = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        const node_image_entry *const p_entry = &p_node_image->p_entries[i];
+        node *p_node = (void *) 0;
+
+        // Error check
+        if ( p_entry->node >= node_quantity ) goto corrupt;
+        if ( p_entry->successor > p_header->successor_quantity || p_header->successor_quantity - p_entry->successor < p_entry->successor_quantity ) goto corrupt;
+
+        // Store the node
+        p_node = p_node_graph->_p_nodes[p_entry->node];
+
+        // Error check
+        if ( p_header->input_quantity - input_offset < p_node->in_quantity ) goto corrupt;
+
+        // Resolve each input slot to the output that feeds it
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            p_schedule->pp_inputs[input_offset + k] = ( p_node->in[k].p_in ) ? &p_node->in[k].p_in->out[p_node->in[k].out_index] : (void *) 0;
+
+        // Store the position of the node
+        p_node->position = i;
+
+        // Store the entry
+        p_schedule->p_entries[i] = (node_schedule_entry)
+        {
+            .p_node               = p_node,
+            .index                = p_entry->node,
+            .input_offset         = input_offset,
+            .predecessor_quantity = p_entry->predecessor_quantity,
+            .successor_offset     = p_entry->successor,
+            .successor_quantity   = p_entry->successor_quantity
+        };
+
+        // Advance the cursor
+        input_offset += p_node->in_quantity;
+    }
+
+    // Return a pointer to the caller
+    *pp_node_graph = p_node_graph;
+
+    // Success
+    return 1;
+
+    failed_to_construct_symbol_table:
+    failed_to_allocate_node:
+    failed_to_construct_data:
+    no_mem:
+
+        // Release the partial node graph
+        node_graph_destroy(&p_node_graph);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Null pointer provided for parameter \"pp_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node_image:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Null pointer provided for parameter \"p_node_image\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Image errors
+        {
+            no_nodes:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Image has no nodes in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            corrupt:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Image is corrupt in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the partial node graph
+                if ( p_node_graph ) node_graph_destroy(&p_node_graph);
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_allocate_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Failed to allocate node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_kind:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Kind \"%s\" is not registered in call to function \"%s\"\n", p_kind_name, __FUNCTION__);
+                #else
+                    (void) p_kind_name;
+                #endif
+
+                // Release the partial node graph
+                node_graph_destroy(&p_node_graph);
+
+                // Error
+                return 0;
+
+            unknown_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Port type \"%s\" is not registered in call to function \"%s\"\n", p_type_name, __FUNCTION__);
+                #else
+                    (void) p_type_name;
+                #endif
+
+                // Release the partial node graph
+                node_graph_destroy(&p_node_graph);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+const char *node_image_data ( const node_image *const p_node_image, size_t index )
+{
+
+    // Argument check
+    if ( p_node_image == (void *) 0 ) return (void *) 0;
+    if ( index >= p_node_image->p_header->node_quantity ) return (void *) 0;
+
+    // Initialized data
+    uint64_t data = p_node_image->p_nodes[index].data;
+
+    // Success
+    return ( data < p_node_image->p_header->text_size ) ? p_node_image->p_text + data : (void *) 0;
+}
+
+int node_image_destroy ( node_image **const pp_node_image )
+{
+
+    // Argument check
+    if ( pp_node_image == (void *) 0 ) goto no_node_image;
+
+    // Initialized data
+    node_image *p_node_image = *pp_node_image;
+
+    // Fast exit
+    if ( p_node_image == (void *) 0 ) return 1;
+
+    // No more pointer for caller
+    *pp_node_image = (void *) 0;
+
+    // Unmap the file
+    munmap(p_node_image->p_base, p_node_image->size);
+
+    // Release the image
+    p_node_image = NODE_REALLOC(p_node_image, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_image:
+                #ifndef NDEBUG
+                    log_error("[node] [image] Null pointer provided for parameter \"pp_node_image\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/** !
+ * Header for batch evaluation of node graphs
+ *
+ * @file node/batch.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// log submodule
+#include <log/log.h>
+
+// json submodule
+#include <json/json.h>
+
+// node module
+#include <node/node.h>
+#include <node/expression.h>
+
+// Records run through the whole schedule at a time
+#ifndef NODE_BATCH_TILE_SIZE
+    #define NODE_BATCH_TILE_SIZE 2048
+#endif
+
+// Structure declarations
+struct node_batch_step_s;
+struct node_batch_s;
+
+// Type definitions
+typedef struct node_batch_step_s node_batch_step;
+typedef struct node_batch_s node_batch;
+
+typedef void (*fn_node_batch_kernel) ( const double *p_a, const double *p_b, double *p_result, size_t quantity );
+
+// Structure definitions
+/** !
+ * One node of a batch, in schedule order. A node with a batch function
+ * is called with the columns of its ports. Otherwise, a node whose data
+ * is an expression runs its compiled expression, with each input
+ * register reading the column in sources, and writes its first output.
+ * Inputs are a range of the column indices in the batch; inputs that 
+ * are not connected read the zero column. A fused step is evaluated by
+ * the expression of the step it feeds, and does not run.
+ */
+struct node_batch_step_s
+{
+    node *p_node;
+    node_expression *p_expression;
+    size_t *p_sources;
+    bool fused;
+    size_t input_offset;
+    size_t output_column;
+};
+
+/** !
+ * A node graph, evaluated over columns of records. Every output port
+ * owns one column of doubles, in one 64 byte aligned block, and column
+ * 0 is all zeros. The temporaries of expressions are tiles of scratch,
+ * shared by every step.
+ */
+struct node_batch_s
+{
+    node_graph *p_node_graph;
+    size_t capacity;
+    size_t stride;
+
+    size_t column_quantity;
+    void *p_block;
+    double *p_columns;
+
+    size_t step_quantity;
+    node_batch_step *p_steps;
+    size_t *p_inputs;
+
+    void *p_scratch_block;
+    double *p_scratch;
+    double **pp_registers;
+    fn_node_batch_kernel pfn_kernels[NODE_EXPRESSION_OP_QUANTITY];
+
+    const double **pp_in;
+    double **pp_out;
+};
+
+// Function declarations
+// Constructors
+/** !
+ * Construct a batch for a node graph, compiling the graph if it is not
+ * compiled. Nodes whose data is an expression over the names of their
+ * input ports are compiled to bytecode, and run by built in SIMD 
+ * kernels. A chain of expression nodes, where each output feeds only
+ * the next node, is fused into one expression, so its intermediate
+ * values stay in scratch; the output columns of the fused nodes are
+ * not written. Other nodes are evaluated by their batch function, and
+ * are skipped if they have none.
+ *
+ * @param pp_node_batch result
+ * @param p_node_graph  the node graph
+ * @param capacity      the most records in one run
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_batch_construct ( node_batch **const pp_node_batch, node_graph *const p_node_graph, size_t capacity );
+
+// Accessors
+/** !
+ * Get the column of a port. The column of an output port is written by
+ * its node; a source node has no function, so the caller fills it. The
+ * column of an input port is the column of the output that feeds it.
+ *
+ * @param p_node_batch the batch
+ * @param p_port       the port, as "node:port"
+ * @param input        true if the port is an input, false if it is an output
+ * @param pp_column    result
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_batch_column ( node_batch *const p_node_batch, const char *const p_port, bool input, double **const pp_column );
+
+// Execution
+/** !
+ * Evaluate the first records of each column. The records are split into
+ * tiles of NODE_BATCH_TILE_SIZE, and the schedule is walked once per
+ * tile, so each tile stays in cache while it passes through the graph.
+ *
+ * @param p_node_batch the batch
+ * @param quantity     the quantity of records, no more than the capacity
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_batch_run ( node_batch *const p_node_batch, size_t quantity );
+
+// Destructors
+/** !
+ * Release a batch. The node graph is not released.
+ *
+ * @param pp_node_batch pointer to the batch
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_batch_destroy ( node_batch **const pp_node_batch );
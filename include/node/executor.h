@@ -0,0 +1,146 @@
+/** !
+ * Header for node graph executors
+ * 
+ * @file node/executor.h
+ * 
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// POSIX
+#include <pthread.h>
+#include <unistd.h>
+#include <sched.h>
+
+// sync submodule
+#include <sync/sync.h>
+
+// log submodule
+#include <log/log.h>
+
+// node module
+#include <node/node.h>
+#include <node/plan.h>
+
+// Enumeration definitions
+enum node_executor_mode_e
+{
+    NODE_EXECUTOR_SHARED_QUEUE  = 0,
+    NODE_EXECUTOR_WORK_STEALING = 1,
+    NODE_EXECUTOR_MODE_QUANTITY = 2
+};
+
+// Structure declarations
+struct node_executor_worker_s;
+struct node_executor_s;
+
+// Type definitions
+typedef struct node_executor_worker_s node_executor_worker;
+typedef struct node_executor_s node_executor;
+
+// Structure definitions
+/** !
+ * A worker thread. In work stealing mode, each worker owns a Chase-Lev
+ * deque. The owner pushes and pops at the bottom, and idle workers 
+ * steal from the top. The ends are padded onto separate cache lines.
+ */
+struct node_executor_worker_s
+{
+    node_executor *p_node_executor;
+    size_t index;
+    pthread_t thread;
+    unsigned long long seed;
+
+    struct
+    {
+        atomic_size_t *p_entries;
+        size_t mask;
+        char _pad0[64];
+        atomic_llong top;
+        char _pad1[64 - sizeof(atomic_llong)];
+        atomic_llong bottom;
+        char _pad2[64 - sizeof(atomic_llong)];
+    } deque;
+};
+
+/** !
+ * A pool of worker threads that runs compiled node graphs. Each run 
+ * loads a dependency counter per schedule entry, and a node is queued
+ * by whichever thread finishes its last predecessor; on a shared queue,
+ * or on that thread's own deque in work stealing mode.
+ */
+struct node_executor_s
+{
+    enum node_executor_mode_e mode;
+    size_t thread_quantity;
+    node_executor_worker *p_workers;
+    atomic_bool stopping;
+
+    // Ready queue
+    struct
+    {
+        mutex _lock;
+        semaphore _ready;
+        size_t head, tail, capacity;
+        size_t *p_entries;
+    } queue;
+
+    // State of the current run
+    struct
+    {
+        node_graph *p_node_graph;
+        const node_schedule *p_schedule;
+        atomic_size_t *p_counters;
+        size_t counter_capacity;
+        atomic_size_t remaining;
+        atomic_size_t active;
+        atomic_bool failed;
+        semaphore _start;
+        semaphore _done;
+    } run;
+};
+
+// Function declarations
+// Constructors
+/** !
+ * Construct an executor and start its worker threads
+ * 
+ * @param pp_node_executor result
+ * @param thread_quantity  the quantity of worker threads, or 0 for one per online processor
+ * @param mode             NODE_EXECUTOR_SHARED_QUEUE or NODE_EXECUTOR_WORK_STEALING
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_executor_construct ( node_executor **const pp_node_executor, size_t thread_quantity, enum node_executor_mode_e mode );
+
+// Execution
+/** !
+ * Run a node graph on an executor, and wait for it to finish. The graph
+ * is compiled on first use. Independent nodes run concurrently, so node
+ * functions must only write to their own outputs.
+ * 
+ * @param p_node_executor the executor
+ * @param p_node_graph    the node graph
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_executor_run ( node_executor *const p_node_executor, node_graph *const p_node_graph );
+
+// Destructors
+/** !
+ * Stop the worker threads of an executor, and release it
+ * 
+ * @param pp_node_executor pointer to the executor
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_executor_destroy ( node_executor **const pp_node_executor );
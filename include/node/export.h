@@ -0,0 +1,69 @@
+/** !
+ * Header for exporting node graphs
+ *
+ * @file node/export.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// log submodule
+#include <log/log.h>
+
+// json submodule
+#include <json/json.h>
+
+// node module
+#include <node/node.h>
+
+// Bytes an export to a file formats before writing them out
+#ifndef NODE_EXPORT_BUFFER_SIZE
+    #define NODE_EXPORT_BUFFER_SIZE 65536
+#endif
+
+// Enumeration definitions
+enum node_export_format_e
+{
+    NODE_EXPORT_DOT  = 0,
+    NODE_EXPORT_JSON = 1
+};
+
+// Function declarations
+// Serialization
+/** !
+ * Write a node graph to a file. In Graphviz DOT, each node is a record
+ * of its inputs, its name and its outputs, and each connection is an
+ * edge between two ports. In json, the graph is written in the format
+ * node_graph_load reads, a node or a connection per line, in the order
+ * of the graph, with the keys of node data sorted. Text is formatted
+ * into a buffer of NODE_EXPORT_BUFFER_SIZE bytes, and written out each
+ * time it fills.
+ *
+ * @param p_node_graph the node graph
+ * @param format       NODE_EXPORT_DOT or NODE_EXPORT_JSON
+ * @param p_file       the file
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_export ( const node_graph *const p_node_graph, enum node_export_format_e format, FILE *const p_file );
+
+/** !
+ * Write a node graph to text, formatted into one growable buffer
+ *
+ * @param p_node_graph the node graph
+ * @param format       NODE_EXPORT_DOT or NODE_EXPORT_JSON
+ * @param pp_text      result; the terminated text, released with NODE_REALLOC(p_text, 0)
+ * @param p_size       result; the length of the text, or null pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_export_text ( const node_graph *const p_node_graph, enum node_export_format_e format, char **const pp_text, size_t *const p_size );
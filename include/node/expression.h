@@ -0,0 +1,151 @@
+/** !
+ * Header for node data expressions
+ *
+ * @file node/expression.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// log submodule
+#include <log/log.h>
+
+// json submodule
+#include <json/json.h>
+
+// node module
+#include <node/node.h>
+
+// Preprocessor definitions
+#define NODE_EXPRESSION_REGISTER_QUANTITY 256
+
+// Enumeration definitions
+enum node_expression_op_e
+{
+    NODE_EXPRESSION_CONSTANT = 0,
+    NODE_EXPRESSION_ADD      = 1,
+    NODE_EXPRESSION_SUBTRACT = 2,
+    NODE_EXPRESSION_MULTIPLY = 3,
+    NODE_EXPRESSION_DIVIDE   = 4,
+    NODE_EXPRESSION_MIN      = 5,
+    NODE_EXPRESSION_MAX      = 6,
+    NODE_EXPRESSION_NEGATE   = 7,
+    NODE_EXPRESSION_ABS      = 8,
+    NODE_EXPRESSION_SQRT     = 9,
+    NODE_EXPRESSION_OP_QUANTITY = 10
+};
+
+// Structure declarations
+struct node_expression_instruction_s;
+struct node_expression_s;
+
+// Type definitions
+typedef struct node_expression_instruction_s node_expression_instruction;
+typedef struct node_expression_s node_expression;
+
+// Structure definitions
+/** !
+ * One instruction. Result, a and b are registers, except for constant
+ * instructions, where a and b are the low and high bytes of an index
+ * into the constants.
+ */
+struct node_expression_instruction_s
+{
+    uint8_t op;
+    uint8_t result;
+    uint8_t a;
+    uint8_t b;
+};
+
+/** !
+ * A compiled expression. Registers [ 0, input_quantity ) hold the
+ * inputs, and temporaries follow them. The value of the expression is
+ * left in register result. The expression, its instructions and its
+ * constants are one allocation, laid out as
+ *
+ *     [ expression ][ constant_quantity x double ][ instruction_quantity x instruction ]
+ */
+struct node_expression_s
+{
+    size_t input_quantity;
+    size_t register_quantity;
+    size_t instruction_quantity;
+    size_t constant_quantity;
+    size_t result;
+    node_expression_instruction *p_instructions;
+    double _constants[];
+};
+
+// Function declarations
+// Compiler
+/** !
+ * Compile an expression. Operands are numbers, and input names, which
+ * are resolved to registers here. Expressions combine them with + - *
+ * and /, unary -, parentheses, and the functions min, max, abs and
+ * sqrt. Constant subexpressions are folded.
+ *
+ * @param pp_node_expression result
+ * @param p_text             the expression
+ * @param pp_inputs          the input names, by register
+ * @param input_quantity     the quantity of inputs
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_expression_compile ( node_expression **const pp_node_expression, const char *const p_text, const char *const *const pp_inputs, size_t input_quantity );
+
+/** !
+ * Compile the expression in a node's data, with the node's inputs as
+ * its inputs
+ *
+ * @param pp_node_expression result
+ * @param p_node             the node, whose data is a string
+ *
+ * @return 1 on success, 0 if the node has no expression, or on error
+ */
+DLLEXPORT int node_expression_node_compile ( node_expression **const pp_node_expression, const node *const p_node );
+
+/** !
+ * Fuse two expressions, so that the value of a producer feeds one input
+ * of a consumer without leaving its registers. The inputs of the result
+ * are the inputs of the consumer, without the fed one, followed by the
+ * inputs of the producer.
+ *
+ * @param pp_node_expression result
+ * @param p_consumer         the consumer
+ * @param input              the input of the consumer that the producer feeds
+ * @param p_producer         the producer
+ *
+ * @return 1 on success, 0 on error, or if the result needs too many registers
+ */
+DLLEXPORT int node_expression_fuse ( node_expression **const pp_node_expression, const node_expression *const p_consumer, size_t input, const node_expression *const p_producer );
+
+// Execution
+/** !
+ * Evaluate an expression for one record
+ *
+ * @param p_node_expression the expression
+ * @param p_inputs          the value of each input
+ * @param p_result          result
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_expression_evaluate ( const node_expression *const p_node_expression, const double *const p_inputs, double *const p_result );
+
+// Destructors
+/** !
+ * Release an expression
+ *
+ * @param pp_node_expression pointer to the expression
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_expression_destroy ( node_expression **const pp_node_expression );
@@ -0,0 +1,228 @@
+/** !
+ * Header for the binary node graph image format
+ * 
+ * @file node/image.h
+ * 
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// log submodule
+#include <log/log.h>
+
+// json submodule
+#include <json/json.h>
+
+// node module
+#include <node/node.h>
+
+// Preprocessor definitions
+#define NODE_IMAGE_MAGIC   "NODEIMG"
+#define NODE_IMAGE_VERSION 2
+#define NODE_IMAGE_ENDIAN  0x01020304
+#define NODE_IMAGE_NONE    UINT64_MAX
+
+// Structure declarations
+struct node_image_header_s;
+struct node_image_node_s;
+struct node_image_input_s;
+struct node_image_output_s;
+struct node_image_entry_s;
+struct node_image_symbol_s;
+struct node_image_s;
+
+// Type definitions
+typedef struct node_image_header_s node_image_header;
+typedef struct node_image_node_s node_image_node;
+typedef struct node_image_input_s node_image_input;
+typedef struct node_image_output_s node_image_output;
+typedef struct node_image_entry_s node_image_entry;
+typedef struct node_image_symbol_s node_image_symbol;
+typedef struct node_image_s node_image;
+
+// Structure definitions
+/** !
+ * An image is a header followed by flat tables of fixed size records, 
+ * and a block of nul terminated text. Every reference is an index into 
+ * a table, or a byte offset into the text, so an image can be mapped 
+ * and read in place.
+ * 
+ *     [ header ][ nodes ][ inputs ][ outputs ][ entries ][ successors ][ symbols ][ text ]
+ */
+struct node_image_header_s
+{
+    char _magic[8];
+    uint32_t version;
+    uint32_t endian;
+    uint64_t size;
+
+    uint64_t node_quantity;
+    uint64_t input_quantity;
+    uint64_t output_quantity;
+    uint64_t entry_quantity;
+    uint64_t successor_quantity;
+    uint64_t symbol_quantity;
+    uint64_t text_size;
+
+    uint64_t nodes;
+    uint64_t inputs;
+    uint64_t outputs;
+    uint64_t entries;
+    uint64_t successors;
+    uint64_t symbols;
+    uint64_t text;
+};
+
+/** !
+ * A node. Id is the symbol of its name. Data and kind are offsets of
+ * the json text of its data and of the name of its kind in the text,
+ * or NODE_IMAGE_NONE.
+ */
+struct node_image_node_s
+{
+    uint64_t id;
+    uint64_t data;
+    uint64_t kind;
+    uint64_t input;
+    uint64_t in_quantity;
+    uint64_t output;
+    uint64_t out_quantity;
+};
+
+/** !
+ * A port. Id is the symbol of its name. Type is the offset of the name
+ * of its registered type in the text, or NODE_IMAGE_NONE if the port 
+ * is untyped.
+ */
+struct node_image_input_s
+{
+    uint64_t id;
+    uint64_t type;
+    uint64_t node;
+    uint64_t port;
+};
+
+struct node_image_output_s
+{
+    uint64_t id;
+    uint64_t type;
+};
+
+struct node_image_entry_s
+{
+    uint64_t node;
+    uint64_t predecessor_quantity;
+    uint64_t successor;
+    uint64_t successor_quantity;
+};
+
+/** !
+ * An interned name, in the order of the symbol table of the saved 
+ * graph, so each id in the image is the id of the name in the graph.
+ * Text is the offset of the name, and hash its hash, so a loaded graph
+ * places each symbol in its table without hashing or comparing names.
+ */
+struct node_image_symbol_s
+{
+    uint64_t text;
+    uint64_t length;
+    uint64_t hash;
+};
+
+/** !
+ * A loaded image. The table pointers are the mapped base plus the 
+ * offsets in the header; nothing in the tables is rewritten.
+ */
+struct node_image_s
+{
+    void *p_base;
+    size_t size;
+
+    const node_image_header *p_header;
+    const node_image_node *p_nodes;
+    const node_image_input *p_inputs;
+    const node_image_output *p_outputs;
+    const node_image_entry *p_entries;
+    const uint64_t *p_successors;
+    const node_image_symbol *p_symbols;
+    const char *p_text;
+};
+
+// Function declarations
+// Serialization
+/** !
+ * Write a node graph to a binary image. The graph is compiled first if
+ * it has no schedule. Node data is stored as json text, with the name
+ * of its kind.
+ * 
+ * @param p_node_graph the node graph
+ * @param p_path       path to the image file
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_image_save ( node_graph *const p_node_graph, const char *const p_path );
+
+/** !
+ * Map a binary image into memory, and check its header
+ * 
+ * @param pp_node_image result
+ * @param p_path        path to the image file
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_image_load ( node_image **const pp_node_image, const char *const p_path );
+
+// Constructors
+/** !
+ * Construct a compiled node graph from a loaded image, without parsing,
+ * sorting or interning. Each name keeps the id it had in the saved 
+ * graph. The graph borrows its names from the image, so the image must
+ * outlive it. Each typed port takes its type from the registry, and 
+ * each typed output a slot in the value block of the graph; an image
+ * with a type that is not registered is rejected. So is an image with
+ * a kind that is not registered; the data of each node with a kind is
+ * parsed, and constructed as by node_graph_construct. The data of other
+ * nodes stays in the image as json text; see node_image_data.
+ * 
+ * @param pp_node_graph result
+ * @param p_node_image  the image
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_image_graph_construct ( node_graph **const pp_node_graph, const node_image *const p_node_image );
+
+// Accessors
+/** !
+ * Get the json text of a node's data
+ * 
+ * @param p_node_image the image
+ * @param index        the index of the node
+ * 
+ * @return the json text, or null pointer if the node has no data
+ */
+DLLEXPORT const char *node_image_data ( const node_image *const p_node_image, size_t index );
+
+// Destructors
+/** !
+ * Unmap a binary image
+ * 
+ * @param pp_node_image pointer to the image
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_image_destroy ( node_image **const pp_node_image );
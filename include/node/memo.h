@@ -0,0 +1,179 @@
+/** !
+ * Header for content addressed memoization of node outputs
+ *
+ * @file node/memo.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// sync submodule
+#include <sync/sync.h>
+
+// log submodule
+#include <log/log.h>
+
+// json submodule
+#include <json/json.h>
+
+// hash cache submodule
+#include <hash_cache/hash.h>
+
+// node module
+#include <node/node.h>
+
+// Preprocessor definitions
+#define NODE_MEMO_MAGIC   "NODEMEM"
+#define NODE_MEMO_VERSION 1
+
+// Structure definitions
+/** !
+ * A cached set of node outputs. The entry and the bytes of its outputs
+ * are one allocation, laid out as
+ *
+ *     [ entry ][ out_quantity x size ][ output 0 ][ output 1 ] ...
+ *
+ * with each output aligned to 16 bytes. An entry is pinned while a
+ * node's output ports point into it, and pinned entries are never
+ * evicted.
+ */
+struct node_memo_entry_s
+{
+    hash64 key;
+    size_t size;
+    size_t pins;
+    size_t out_quantity;
+    node_memo_entry *p_chain;
+    node_memo_entry *p_prev;
+    node_memo_entry *p_next;
+    size_t _sizes[];
+};
+
+/** !
+ * A bounded, least recently used cache of node outputs, keyed by a
+ * hash of a node's name, its data, and the hashes of its inputs.
+ * Entries are found through a chained hash table, and kept in use
+ * order on a doubly linked list; p_head is the most recently used.
+ */
+struct node_memo_s
+{
+    mutex _lock;
+    size_t capacity;
+    size_t used;
+
+    size_t bucket_quantity;
+    size_t entry_quantity;
+    node_memo_entry **pp_buckets;
+
+    node_memo_entry *p_head;
+    node_memo_entry *p_tail;
+
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+};
+
+// Function declarations
+// Constructors
+/** !
+ * Construct an empty memo
+ *
+ * @param pp_node_memo result
+ * @param capacity     the most bytes of cached outputs to keep
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_memo_construct ( node_memo **const pp_node_memo, size_t capacity );
+
+// Hashing
+/** !
+ * Mix a value into a hash
+ *
+ * @param h the hash
+ * @param v the value
+ *
+ * @return the mixed hash
+ */
+DLLEXPORT hash64 node_memo_mix ( hash64 h, hash64 v );
+
+/** !
+ * Hash a json value by content. The properties of an object hash the
+ * same in any order.
+ *
+ * @param p_value the json value
+ *
+ * @return the hash
+ */
+DLLEXPORT hash64 node_memo_json_hash ( const json_value *const p_value );
+
+// Execution
+/** !
+ * Run a node through a memo. If the node is not memoized, it runs, and
+ * each output is hashed by content. Otherwise, its outputs are served
+ * from the memo when the key matches, and the node function is skipped;
+ * on a miss the node runs and its outputs are copied into the memo.
+ *
+ * Only outputs with a size are cached. A memoized node that leaves an
+ * output with a value and no size runs every time.
+ *
+ * @param p_node_memo the memo
+ * @param p_node      the node, with its inputs loaded
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_memo_run ( node_memo *const p_node_memo, node *const p_node );
+
+// Serialization
+/** !
+ * Write every entry of a memo to a file. Output bytes are written as
+ * they are, so only outputs without pointers survive a reload.
+ *
+ * @param p_node_memo the memo
+ * @param p_path      path to the file
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_memo_save ( node_memo *const p_node_memo, const char *const p_path );
+
+/** !
+ * Add the entries of a file written by node_memo_save to a memo
+ *
+ * @param p_node_memo the memo
+ * @param p_path      path to the file
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_memo_load ( node_memo *const p_node_memo, const char *const p_path );
+
+// Info
+/** !
+ * Get the hit, miss and eviction counters of a memo
+ *
+ * @param p_node_memo the memo
+ * @param p_hits      result; the quantity of runs served from the memo, or null pointer
+ * @param p_misses    result; the quantity of memoized runs that called the node function, or null pointer
+ * @param p_evictions result; the quantity of entries evicted, or null pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_memo_statistics ( node_memo *const p_node_memo, size_t *const p_hits, size_t *const p_misses, size_t *const p_evictions );
+
+// Destructors
+/** !
+ * Release a memo and its entries. Nodes that were served from the memo
+ * point into it, so it must outlive every graph that uses it.
+ *
+ * @param pp_node_memo pointer to the memo
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_memo_destroy ( node_memo **const pp_node_memo );
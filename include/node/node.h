@@ -14,6 +14,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+// POSIX
+#include <pthread.h>
+#include <unistd.h>
 
 // sync submodule
 #include <sync/sync.h>
@@ -30,6 +36,9 @@
 // json submodule
 #include <json/json.h>
 
+// hash cache submodule
+#include <hash_cache/hash.h>
+
 // Platform dependent macros
 #ifdef _WIN64
     #define DLLEXPORT extern __declspec(dllexport)
@@ -60,46 +69,375 @@
     #define NODE_REALLOC(p, sz) realloc(p,sz)
 #endif
 
+// Size of the first block of a node arena
+#ifndef NODE_ARENA_BLOCK_SIZE
+    #define NODE_ARENA_BLOCK_SIZE 65536
+#endif
+
+// Alignment of each block of port values. A power of two, and at least the alignment of any port type
+#ifndef NODE_VALUE_ALIGNMENT
+    #define NODE_VALUE_ALIGNMENT 64
+#endif
+
+// Fewest nodes given to one thread when node data is constructed
+#ifndef NODE_DATA_SHARD_SIZE
+    #define NODE_DATA_SHARD_SIZE 16
+#endif
+
+// Fewest nodes, names or connections given to one thread when a graph is constructed
+#ifndef NODE_CONSTRUCT_SHARD_SIZE
+    #define NODE_CONSTRUCT_SHARD_SIZE 4096
+#endif
+
+// Properties of a JSON object that are compared without allocating
+#ifndef NODE_JSON_KEY_QUANTITY
+    #define NODE_JSON_KEY_QUANTITY 16
+#endif
+
 // Structure declarations
 struct node_s;
+struct node_input_s;
+struct node_output_s;
+struct node_edge_s;
+struct node_adjacency_s;
+struct node_arena_block_s;
+struct node_arena_s;
+struct node_symbol_s;
+struct node_symbol_table_s;
+struct node_schedule_entry_s;
+struct node_schedule_s;
 struct node_graph_s;
+struct node_memo_entry_s;
+struct node_memo_s;
+struct node_plan_s;
+struct node_snapshot_domain_s;
+struct node_data_kind_s;
+struct node_port_type_s;
+struct node_shard_s;
+struct node_reload_report_s;
 
 // Type definitions
 typedef struct node_s node;
+typedef struct node_input_s node_input;
+typedef struct node_output_s node_output;
+typedef struct node_edge_s node_edge;
+typedef struct node_adjacency_s node_adjacency;
+typedef struct node_arena_block_s node_arena_block;
+typedef struct node_arena_s node_arena;
+typedef struct node_symbol_s node_symbol;
+typedef struct node_symbol_table_s node_symbol_table;
+typedef struct node_schedule_entry_s node_schedule_entry;
+typedef struct node_schedule_s node_schedule;
 typedef struct node_graph_s node_graph;
+typedef struct node_memo_entry_s node_memo_entry;
+typedef struct node_memo_s node_memo;
+typedef struct node_plan_s node_plan;
+typedef struct node_snapshot_domain_s node_snapshot_domain;
+typedef struct node_data_kind_s node_data_kind;
+typedef struct node_port_type_s node_port_type;
+typedef struct node_shard_s node_shard;
+typedef struct node_reload_report_s node_reload_report;
 
 typedef int (*fn_node_data_constructor) ( const json_value *const p_value, void **pp_result );
+typedef void (*fn_node_data_destructor) ( void *p_data );
+typedef int (*fn_node_function) ( node *p_node );
+typedef int (*fn_node_batch_function) ( node *p_node, const double *const *pp_in, double *const *pp_out, size_t quantity );
+typedef int (*fn_node_shard) ( node_shard *p_shard );
 
 // Structure definitions
+/** !
+ * An input declared with a type reads a value of that type, or has a
+ * null type.
+ */
+struct node_input_s
+{
+    const char *p_name;
+    size_t id;
+    void *value;
+    size_t out_index;
+    node *p_in;
+    const node_port_type *p_type;
+};
+
+/** !
+ * Size is the quantity of bytes value points to, or 0 if it is not 
+ * known. Hash identifies the value for memoization, or is 0. An output
+ * may feed any number of inputs; its readers are the successor edges
+ * of its node. An output declared with a type has the size of the 
+ * type, and its value points at a slot in the value block of its 
+ * graph, which the node writes into, and its readers read in place.
+ * While a memo serves the output from one of its entries, the value
+ * and size the node set are kept in own_value and own_size, and are
+ * given back before the node runs again.
+ */
+struct node_output_s
+{
+    const char *p_name;
+    size_t id;
+    void *value;
+    size_t size;
+    hash64 hash;
+    const node_port_type *p_type;
+    void *own_value;
+    size_t own_size;
+};
+
+/** !
+ * One connection, from output out_index to input in_index, seen from 
+ * one of its ends. The node is the node at the other end.
+ */
+struct node_edge_s
+{
+    node *p_node;
+    size_t out_index;
+    size_t in_index;
+};
+
+/** !
+ * The edges of every node of a graph, in compressed sparse row form.
+ * The edges of the node with index i are the run of p_edges that starts
+ * at p_offsets[i] and holds p_quantities[i] edges, with room for
+ * p_capacities[i]. Built from the ports of a graph, the runs are packed
+ * in node order. An edit that fills a run moves it to the end of the
+ * edges with twice the room, and the runs are packed again once most 
+ * of the used edges have been abandoned.
+ */
+struct node_adjacency_s
+{
+    size_t row_capacity;
+    size_t *p_offsets;
+    size_t *p_quantities;
+    size_t *p_capacities;
+
+    size_t edge_quantity;
+    size_t used;
+    size_t edge_capacity;
+    node_edge *p_edges;
+};
+
+/** !
+ * A node and its ports live in one allocation, laid out as
+ * 
+ *     [ node ][ in_quantity x node_input ][ out_quantity x node_output ][ name text ]
+ * 
+ * so memory per node scales with its real port count. Position is the
+ * place of the node in the topological order of its graph, which is
+ * the compiled schedule until the graph is edited. Visited marks the
+ * node while an edit searches the graph. If owns_value is set, 
+ * value is a json value that is released with the node. A node whose 
+ * data holds a graph of its own keeps it in p_subgraph. A node with a 
+ * "kind" property keeps the data its kind constructs in p_data. A node
+ * that owns its memory was allocated on its own, rather than from the
+ * arena of its graph, and is released once it is removed.
+ */
 struct node_s
 {
-    char _name[255 + 1];
+    const char *p_name;
+    size_t id;
+    size_t index;
+    size_t position;
+    bool dirty;
+    bool memoize;
+    bool visited;
+    hash64 data_hash;
+    node_memo_entry *p_memo_entry;
 
     size_t in_quantity;
     size_t out_quantity;
 
-    struct
-    {
-        char _name[31+1];
-        void *value;
-        size_t out_index;
-        node *p_in;
-    } in [64];
-
-    struct
-    {
-        char _name[31+1];
-        void *value;
-        size_t in_index;
-        node *p_out;
-    } out [64];
+    node_input  *in;
+    node_output *out;
 
+    fn_node_function pfn_function;
+    fn_node_batch_function pfn_batch_function;
     void *value;
+    bool owns_value;
+    bool owns_memory;
+    node_graph *p_subgraph;
+
+    const node_data_kind *p_kind;
+    void *p_data;
+};
+
+/** !
+ * A registered kind of node data. The constructor builds p_data from
+ * the "data" property of each node of the kind, and the destructor 
+ * releases it with the node. Constructors run concurrently, on 
+ * different nodes, and must be safe to call from any thread.
+ */
+struct node_data_kind_s
+{
+    const char *p_name;
+    fn_node_data_constructor pfn_constructor;
+    fn_node_data_destructor pfn_destructor;
+};
+
+/** !
+ * A registered type of port value. A port is declared with a type as 
+ * { "name" : "type" } in the "in" or "out" list of its node.
+ */
+struct node_port_type_s
+{
+    const char *p_name;
+    size_t size;
+    size_t alignment;
+};
+
+/** !
+ * A contiguous range [ begin, end ) of some work, done by one thread. 
+ * Index is the position of the shard among its siblings. If any shard
+ * fails, p_failed is set, and the others may stop early.
+ */
+struct node_shard_s
+{
+    void *p_context;
+    size_t index;
+    size_t begin;
+    size_t end;
+    fn_node_shard pfn_shard;
+    atomic_bool *p_failed;
+    pthread_t thread;
+};
+
+/** !
+ * What a reload changed. Added nodes are new, removed nodes are gone,
+ * replaced nodes changed their ports or kind and were built again, and
+ * updated nodes kept their ports and took new data. Every other node
+ * was left as it was.
+ */
+struct node_reload_report_s
+{
+    size_t added_quantity;
+    size_t removed_quantity;
+    size_t replaced_quantity;
+    size_t updated_quantity;
+    size_t connected_quantity;
+    size_t disconnected_quantity;
+};
+
+/** !
+ * A bump allocator. Allocations are never released one at a time; the
+ * blocks are released together when the arena is. Each new block is
+ * twice the size of the last, so a graph lives in a few large blocks.
+ */
+struct node_arena_block_s
+{
+    node_arena_block *p_next;
+    size_t size;
+    size_t used;
+    max_align_t _data[];
+};
+
+struct node_arena_s
+{
+    node_arena_block *p_head;
+    size_t block_size;
+};
+
+/** !
+ * An interned node or port name. Symbol ids are dense, starting at 0,
+ * and are assigned in the order names are first seen by the graph.
+ */
+struct node_symbol_s
+{
+    hash64 hash;
+    const char *p_text;
+    size_t length;
+    node *p_node;
+};
+
+/** !
+ * A graph wide string interner. Names are stored once in p_symbols, 
+ * indexed by id, and found through an open addressed table of ids.
+ */
+struct node_symbol_table_s
+{
+    size_t quantity;
+    size_t capacity;
+    node_symbol *p_symbols;
+    size_t *p_slots;
+};
+
+/** !
+ * One step of a compiled schedule. Inputs and successors are ranges 
+ * of the flat arrays in the schedule that owns the entry. An entry 
+ * with a nonzero fused quantity runs that many entries after it, as
+ * one unit; see node_graph_optimize.
+ */
+struct node_schedule_entry_s
+{
+    node *p_node;
+    size_t index;
+    size_t input_offset;
+    size_t predecessor_quantity;
+    size_t successor_offset;
+    size_t successor_quantity;
+    size_t fused_quantity;
 };
 
+/** !
+ * A topologically sorted, flat execution plan. Entry i of pp_inputs 
+ * is the output port that feeds input i of its entry, or null if the
+ * input is not connected. Successors are positions in p_entries.
+ */
+struct node_schedule_s
+{
+    size_t entry_quantity;
+    node_schedule_entry *p_entries;
+    node_output **pp_inputs;
+    size_t *p_successors;
+};
+
+/** !
+ * A node graph. Its nodes, their ports, and the name text the symbol
+ * table refers to are allocated from the graph's arena, and the values
+ * of typed outputs from its values arena. Each input port points at 
+ * the output that feeds it; the edges hold the same
+ * connections as successors and predecessors of each node, and are 
+ * built from the ports when first needed. Dirty nodes wait in a binary
+ * heap ordered by schedule position. If p_memo is set, every node runs
+ * through it. If p_plan is set, planned outputs point into its arena,
+ * until the schedule changes. If p_snapshots is set, readers on other
+ * threads see the graph through the snapshots it published. Once 
+ * ordered, the positions of the nodes stay a topological order while
+ * the graph is edited; new nodes take positions from position_quantity
+ * up. The rest of the order state is scratch for the searches of an
+ * edit.
+ */
 struct node_graph_s
 {
-    dict *p_nodes;
+    node_arena arena;
+    node_arena values;
+    node_symbol_table symbols;
+    node_schedule *p_schedule;
+    node_memo *p_memo;
+    node_plan *p_plan;
+    node_snapshot_domain *p_snapshots;
+
+    struct
+    {
+        node **pp_nodes;
+        size_t quantity;
+        size_t capacity;
+    } dirty;
+
+    struct
+    {
+        bool valid;
+        node_adjacency successors;
+        node_adjacency predecessors;
+    } edges;
+
+    struct
+    {
+        bool ordered;
+        size_t position_quantity;
+        size_t capacity;
+        node **pp_stack;
+        node **pp_forward;
+        node **pp_backward;
+        size_t *p_positions;
+    } order;
 
     struct
     {
@@ -107,7 +445,8 @@ struct node_graph_s
     } functions;
     
     size_t node_quantity;
-    node *_p_nodes[];
+    size_t node_capacity;
+    node **_p_nodes;
 };
 
 // Function declarations
@@ -121,6 +460,174 @@ struct node_graph_s
  */
 DLLEXPORT void node_init ( void ) __attribute__((constructor));
 
+// Allocators
+/** !
+ * Allocate memory from an arena
+ * 
+ * @param p_arena   the arena
+ * @param size      the size of the allocation, in bytes
+ * @param pp_result result
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_arena_allocate ( node_arena *const p_arena, size_t size, void **const pp_result );
+
+/** !
+ * Release every block of an arena
+ * 
+ * @param p_arena the arena
+ * 
+ * @return void
+ */
+DLLEXPORT void node_arena_release ( node_arena *const p_arena );
+
+/** !
+ * Move every block of one arena into another. The current block of the
+ * destination stays current, and the source is left empty.
+ * 
+ * @param p_arena the destination arena
+ * @param p_other the source arena
+ * 
+ * @return void
+ */
+DLLEXPORT void node_arena_merge ( node_arena *const p_arena, node_arena *const p_other );
+
+/** !
+ * Allocate a zeroed node with room for its ports and name text
+ * 
+ * @param pp_node      result
+ * @param p_arena      the arena, or null pointer to allocate the node on its own
+ * @param in_quantity  the quantity of inputs
+ * @param out_quantity the quantity of outputs
+ * @param text_size    the size of the text that follows the ports, in bytes
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_create ( node **pp_node, node_arena *p_arena, size_t in_quantity, size_t out_quantity, size_t text_size );
+
+/** !
+ * Allocate a zeroed node graph with room for its node pointers
+ * 
+ * @param pp_node_graph result
+ * @param node_quantity the quantity of nodes
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_create ( node_graph **pp_node_graph, size_t node_quantity );
+
+// Parallelism
+/** !
+ * Get the quantity of shards some work is split into
+ * 
+ * @param quantity        the quantity of items of work
+ * @param minimum         the fewest items given to one shard
+ * @param thread_quantity the most shards, or 0 for one per online processor
+ * 
+ * @return the quantity of shards
+ */
+DLLEXPORT size_t node_shard_quantity ( size_t quantity, size_t minimum, size_t thread_quantity );
+
+/** !
+ * Split some work into contiguous shards, and run each on its own 
+ * thread. The first shard runs on the calling thread, and the call 
+ * returns once every shard is done. Shards are numbered as they are by
+ * node_shard_quantity, so callers can size per shard state ahead.
+ * 
+ * @param quantity        the quantity of items of work
+ * @param minimum         the fewest items given to one shard
+ * @param thread_quantity the most shards, or 0 for one per online processor
+ * @param pfn_shard       pointer to function that does the work of one shard
+ * @param p_context       the context of each shard
+ * 
+ * @return 1 if every shard succeeded, 0 otherwise
+ */
+DLLEXPORT int node_shards_run ( size_t quantity, size_t minimum, size_t thread_quantity, fn_node_shard pfn_shard, void *p_context );
+
+// Symbols
+/** !
+ * Construct an empty symbol table
+ * 
+ * @param p_symbol_table the symbol table
+ * @param capacity       the expected quantity of symbols
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_symbol_table_construct ( node_symbol_table *const p_symbol_table, size_t capacity );
+
+/** !
+ * Find the id of a symbol
+ * 
+ * @param p_symbol_table the symbol table
+ * @param p_text         the text of the symbol
+ * @param length         the length of the text
+ * @param hash           the hash of the text
+ * @param p_id           result
+ * 
+ * @return 1 if found, 0 otherwise
+ */
+DLLEXPORT int node_symbol_table_find ( const node_symbol_table *const p_symbol_table, const char *const p_text, size_t length, hash64 hash, size_t *const p_id );
+
+/** !
+ * Get the id of a symbol, adding it if it is new. The text is not 
+ * copied, and must outlive the symbol table.
+ * 
+ * @param p_symbol_table the symbol table
+ * @param p_text         the text of the symbol
+ * @param length         the length of the text
+ * @param p_id           result
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_symbol_table_intern ( node_symbol_table *const p_symbol_table, const char *const p_text, size_t length, size_t *const p_id );
+
+// Data kinds
+/** !
+ * Register a kind of node data. Nodes select a kind by name with their
+ * "kind" property. Kinds are registered before the graphs that use 
+ * them are constructed, and live until the program exits.
+ * 
+ * @param p_name          the name of the kind
+ * @param pfn_constructor pointer to function that constructs data from the "data" property of a node
+ * @param pfn_destructor  pointer to function that releases constructed data, or null pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_data_kind_register ( const char *const p_name, fn_node_data_constructor pfn_constructor, fn_node_data_destructor pfn_destructor );
+
+/** !
+ * Get a registered kind of node data
+ * 
+ * @param p_name the name of the kind
+ * 
+ * @return the kind, or null pointer if no kind has the name
+ */
+DLLEXPORT const node_data_kind *node_data_kind_get ( const char *const p_name );
+
+/** !
+ * Register a type of port value. The types bool, int, uint, float, 
+ * double, vec2, vec3, vec4, mat2, mat3 and mat4 are registered at 
+ * startup; vectors and matrices are of float, matrices are stored as
+ * columns, and vec3 and the columns of mat3 are padded to 16 bytes.
+ * Types are registered before the graphs that use them are constructed,
+ * and live until the program exits.
+ * 
+ * @param p_name    the name of the type
+ * @param size      the size of a value, in bytes
+ * @param alignment the alignment of a value; a power of two, at most NODE_VALUE_ALIGNMENT
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_port_type_register ( const char *const p_name, size_t size, size_t alignment );
+
+/** !
+ * Get a registered type of port value
+ * 
+ * @param p_name the name of the type
+ * 
+ * @return the type, or null pointer if no type has the name
+ */
+DLLEXPORT const node_port_type *node_port_type_get ( const char *const p_name );
+
 // Constructor
 /** !
  * Construct a node from a json object
@@ -140,7 +647,67 @@ DLLEXPORT int node_construct (
 );
 
 /** !
- * Construct a node graph from a json object
+ * Construct a node from a json object, allocating it from an arena
+ * 
+ * @param pp_node                   result
+ * @param p_arena                   the arena, or null pointer to allocate the node on its own
+ * @param p_name                    the name of the node
+ * @param p_value                   the json object
+ * @param pfn_node_data_constructor pointer to function that constructs node data from "data" property
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_construct_in_arena (
+    node **pp_node,
+    node_arena *p_arena,
+    const char *const p_name,
+    const json_value *const p_value,
+    fn_node_data_constructor *pfn_node_data_constructor
+);
+
+/** !
+ * Construct the graph nested in a node's json data, if there is one. A
+ * nested graph is the first object found, depth first, that has a 
+ * "nodes" object.
+ * 
+ * @param p_node the node
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_subgraph_construct ( node *const p_node );
+
+/** !
+ * Construct the data of each node of a graph that has a kind, and no
+ * data yet. The nodes are split into contiguous shards, and each shard
+ * is constructed by its own thread. 
+ * 
+ * @param p_node_graph    the node graph
+ * @param thread_quantity the most threads to use, or 0 for one per online processor
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_data_construct ( node_graph *const p_node_graph, size_t thread_quantity );
+
+/** !
+ * Give each typed output without a value, of the nodes from index 
+ * begin up, a zeroed slot. The slots of one call are laid out in one
+ * block aligned to NODE_VALUE_ALIGNMENT, each at the alignment of its
+ * type. Constructing, loading, flattening and editing a graph do this
+ * for the nodes they add.
+ * 
+ * @param p_node_graph the node graph
+ * @param begin        the index of the first node
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_values_allocate ( node_graph *const p_node_graph, size_t begin );
+
+/** !
+ * Construct a node graph from a json object. Nodes are built, their 
+ * names interned, and connections resolved in parallel shards; symbol
+ * ids come out the same as if every name was interned in order. When 
+ * two connections write the same port, the later one wins. The data of
+ * its nodes is constructed in parallel, by node_graph_data_construct.
  * 
  * @param pp_node result
  * @param p_value the json object
@@ -152,9 +719,273 @@ DLLEXPORT int node_graph_construct (
     const json_value *const p_value
 );
 
+/** !
+ * Load a node graph from a json file. The file is mapped and read in
+ * one pass; nodes are built as they are read, and no json value is 
+ * kept for the document. Each "data" property is parsed on its own, 
+ * and is owned by its node. Once every node is read, node data is 
+ * constructed in parallel, by node_graph_data_construct.
+ * 
+ * @param pp_node_graph result
+ * @param p_path        path to the json file
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_load ( node_graph **pp_node_graph, const char *const p_path );
+
+// Compiler
+/** !
+ * Inline the subgraph of each node into its graph. Inner nodes are 
+ * copied in and named "container/inner". Each container input feeds 
+ * the unconnected inner inputs with the same port name, and each 
+ * container output is read from the deepest unconnected inner output 
+ * with the same port name. The container stays in the graph with 
+ * whatever ports were not bridged. On error, the graph is unchanged.
+ * 
+ * @param p_node_graph the node graph
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_flatten ( node_graph *const p_node_graph );
+
+/** !
+ * Flatten a node graph, then topologically sort it into a flat 
+ * schedule. A node that is the only successor of its last ready 
+ * predecessor follows it directly, so chains are contiguous. If the
+ * graph has a cycle, the nodes that form it are logged, and the graph
+ * is left uncompiled.
+ * 
+ * @param p_node_graph the node graph
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_compile ( node_graph *const p_node_graph );
+
+// Execution
+/** !
+ * Run each node of a compiled node graph in schedule order. Before a 
+ * node function is called, each input value is loaded from the output
+ * that feeds it. Nodes without a function are skipped.
+ * 
+ * @param p_node_graph the node graph
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_execute ( node_graph *const p_node_graph );
+
+/** !
+ * Run one entry of a compiled schedule. Each input value is loaded from
+ * the output that feeds it, then the node function is called, through
+ * the graph's memo if it has one.
+ * 
+ * @param p_node_graph the node graph
+ * @param p_entry      the schedule entry
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_entry_run ( node_graph *const p_node_graph, const node_schedule_entry *const p_entry );
+
+/** !
+ * Mark a node dirty, so the next update runs it and everything 
+ * downstream of it
+ * 
+ * @param p_node_graph the node graph
+ * @param p_node       the node
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_dirty_mark ( node_graph *const p_node_graph, node *const p_node );
+
+/** !
+ * Run only the dirty nodes of a node graph, and the nodes their outputs
+ * feed, in schedule order. Every other node keeps the values left on 
+ * its ports by the last run. The cost is proportional to the quantity 
+ * of nodes that run, not to the size of the graph.
+ * 
+ * @param p_node_graph the node graph
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_update ( node_graph *const p_node_graph );
+
+// Editors
+/** !
+ * Add a node to a node graph. The node is built from a json object, as
+ * nodes are by node_graph_construct, and borrows its data. It takes the
+ * last place in the topological order, and is marked dirty. Nodes whose
+ * data holds a nested graph can not be added. The compiled schedule is
+ * released, and rebuilt by the next full run.
+ * 
+ * @param p_node_graph the node graph
+ * @param p_name       the name of the node
+ * @param p_value      the json object
+ * @param pp_node      result, or null
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_add_node ( node_graph *const p_node_graph, const char *const p_name, const json_value *const p_value, node **const pp_node );
+
+/** !
+ * Remove a node from a node graph. Its connections are removed, and 
+ * each node it fed is marked dirty. Its data is released, but its 
+ * memory stays in the graph arena until the graph is released.
+ * 
+ * @param p_node_graph the node graph
+ * @param p_name       the name of the node
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_remove_node ( node_graph *const p_node_graph, const char *const p_name );
+
+/** !
+ * Connect an output to an input, and mark the node of the input dirty.
+ * An output may feed any number of inputs, but each input is fed by at
+ * most one output. The topological order is repaired with the 
+ * Pearce-Kelly algorithm, which only visits the nodes between the two
+ * ends of the connection in the order. A connection that would close a
+ * cycle is rejected, and the graph is left as it was.
+ * 
+ * @param p_node_graph the node graph
+ * @param p_from       the output, as "node:port"
+ * @param p_to         the input, as "node:port"
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_connect ( node_graph *const p_node_graph, const char *const p_from, const char *const p_to );
+
+/** !
+ * Disconnect an output from an input, and mark the node of the input
+ * dirty
+ * 
+ * @param p_node_graph the node graph
+ * @param p_from       the output, as "node:port"
+ * @param p_to         the input, as "node:port"
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_disconnect ( node_graph *const p_node_graph, const char *const p_from, const char *const p_to );
+
+/** !
+ * Patch a node graph to match a new description of it, in the json
+ * node_graph_construct reads. Nodes are matched by name. Nodes that 
+ * are not described are removed, new ones are added, and nodes whose
+ * ports or kind changed are built again. A node whose data alone 
+ * changed keeps its place, its outputs and its connections, and takes
+ * the new data. Then each input is connected as described. Only what
+ * changed is marked dirty; every other node keeps its outputs, its 
+ * memo entry and its place in the order. 
+ *
+ * Nodes are checked before the graph is changed, but connections are
+ * resolved once the nodes are patched, so a bad connection leaves a
+ * graph with its nodes patched. New and changed data is borrowed from
+ * the description, as by node_graph_construct, and so is the data of
+ * unchanged nodes that borrowed theirs; the description must outlive
+ * the graph, or its next reload. A node whose data holds a nested 
+ * graph can only change its data.
+ *
+ * Each name of the description is looked up once, and the nodes and
+ * the connections are compared across threads, as when the graph is
+ * constructed. The comparison still reads the whole description, so
+ * its cost grows with the size of the graph; the patch that follows
+ * only costs as much as what changed.
+ * 
+ * @param p_node_graph the node graph
+ * @param p_value      the json object
+ * @param p_report     result; what changed, or null pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_reload ( node_graph *const p_node_graph, const json_value *const p_value, node_reload_report *const p_report );
+
+// Accessors
+/** !
+ * Compare two json values. Objects are equal if they have the same 
+ * properties, in any order.
+ * 
+ * @param p_a a json value, or null pointer
+ * @param p_b a json value, or null pointer
+ * 
+ * @return true if the values are equal, else false
+ */
+DLLEXPORT bool node_json_equal ( const json_value *const p_a, const json_value *const p_b );
+
+/** !
+ * Resolve a "node:port" string to a node and the index of one of its 
+ * ports
+ * 
+ * @param p_node_graph the node graph
+ * @param p_text       the connection text
+ * @param input        true to search the inputs of the node, false to search the outputs
+ * @param pp_node      result; the node
+ * @param p_index      result; the index of the port
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_port_resolve ( const node_graph *const p_node_graph, const char *const p_text, bool input, node **const pp_node, size_t *const p_index );
+
+/** !
+ * Get a node from a node graph by name
+ * 
+ * @param p_node_graph the node graph
+ * @param p_name       the name of the node
+ * @param pp_node      result
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_node_get ( const node_graph *const p_node_graph, const char *const p_name, node **const pp_node );
+
+/** !
+ * Get the symbol id of a node or port name
+ * 
+ * @param p_node_graph the node graph
+ * @param p_name       the name of the node or port
+ * @param p_id         result
+ * 
+ * @return 1 on success, 0 if the name is not known to the graph
+ */
+DLLEXPORT int node_graph_symbol_get ( const node_graph *const p_node_graph, const char *const p_name, size_t *const p_id );
+
+/** !
+ * Get the edges of a node, as one contiguous run, building the edges of
+ * the graph if they are not built. Successor edges name the node each 
+ * output of the node feeds, and predecessor edges the node that feeds 
+ * each connected input. The run is valid until the graph is edited.
+ * 
+ * @param p_node_graph the node graph
+ * @param p_node       the node
+ * @param successors   true for the successors of the node, false for its predecessors
+ * @param pp_edges     result; the first edge
+ * @param p_quantity   result; the quantity of edges
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_edges_get ( node_graph *const p_node_graph, const node *const p_node, bool successors, const node_edge **const pp_edges, size_t *const p_quantity );
+
+// Destructors
+/** !
+ * Release a node that was constructed with node_construct. Nodes that 
+ * belong to a node graph are released with the graph.
+ * 
+ * @param pp_node pointer to the node
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_destroy ( node **const pp_node );
+
+/** !
+ * Release a node graph, its nodes, its ports, its symbols and its 
+ * schedule. Node data is released only if the node owns it.
+ * 
+ * @param pp_node_graph pointer to the node graph
+ * 
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_destroy ( node_graph **const pp_node_graph );
+
 // Info
 /** !
- * Print a node graph to standard out
+ * Print a node graph to standard out, as the json node_graph_export
+ * writes
  * 
  * @param p_node_graph the node graph
  * 
@@ -0,0 +1,95 @@
+/** !
+ * Header for optimizing node graphs
+ *
+ * @file node/optimize.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// log submodule
+#include <log/log.h>
+
+// json submodule
+#include <json/json.h>
+
+// node module
+#include <node/node.h>
+#include <node/memo.h>
+
+// Enumeration definitions
+enum node_optimize_pass_e
+{
+    NODE_OPTIMIZE_DEAD  = 1 << 0,
+    NODE_OPTIMIZE_MERGE = 1 << 1,
+    NODE_OPTIMIZE_FUSE  = 1 << 2,
+    NODE_OPTIMIZE_ALL   = NODE_OPTIMIZE_DEAD | NODE_OPTIMIZE_MERGE | NODE_OPTIMIZE_FUSE
+};
+
+// Structure declarations
+struct node_optimize_report_s;
+
+// Type definitions
+typedef struct node_optimize_report_s node_optimize_report;
+
+// Structure definitions
+/** !
+ * What an optimization did. Dead nodes could not reach a sink, merged
+ * nodes were identical to a node that was kept, and each chain fused
+ * its fused quantity of nodes into the entry before them. The names of
+ * the removed nodes, dead first, point into the arena of the graph.
+ */
+struct node_optimize_report_s
+{
+    size_t dead_quantity;
+    size_t merged_quantity;
+    size_t chain_quantity;
+    size_t fused_quantity;
+    size_t removed_quantity;
+    const char **pp_removed;
+};
+
+// Function declarations
+// Optimization
+/** !
+ * Optimize a node graph, then compile it.
+ *
+ * Dead node elimination removes each node that no sink reads from,
+ * directly or through other nodes. Merging finds nodes with the same
+ * function, kind, ports, data and inputs, in schedule order, and moves
+ * the readers of each onto the first, which is kept. Nodes without a
+ * function or data, or with an unconnected input, are fed by the 
+ * caller, so they are never merged, and neither are sinks. Fusion 
+ * makes each chain of entries, where every entry but the first has the
+ * one before as its only predecessor and is its only successor, run as
+ * one unit of the executor. Recompiling the graph, as an edit will, 
+ * undoes fusion.
+ *
+ * @param p_node_graph  the node graph
+ * @param pp_sinks      the names of the sinks, or null pointer for each node with no outputs
+ * @param sink_quantity the quantity of sinks
+ * @param passes        the passes to run; NODE_OPTIMIZE_ALL for each
+ * @param p_report      result; what the passes did, or null pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_optimize ( node_graph *const p_node_graph, const char *const *const pp_sinks, size_t sink_quantity, int passes, node_optimize_report *const p_report );
+
+// Destructors
+/** !
+ * Release the memory of an optimization report
+ *
+ * @param p_report the report
+ *
+ * @return void
+ */
+DLLEXPORT void node_optimize_report_release ( node_optimize_report *const p_report );
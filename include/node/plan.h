@@ -0,0 +1,100 @@
+/** !
+ * Header for planning the buffers of node outputs
+ *
+ * @file node/plan.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// log submodule
+#include <log/log.h>
+
+// node module
+#include <node/node.h>
+
+// Alignment of each buffer in the arena of a plan. A power of two
+#ifndef NODE_PLAN_ALIGNMENT
+    #define NODE_PLAN_ALIGNMENT 16
+#endif
+
+// Structure declarations
+struct node_plan_buffer_s;
+
+// Type definitions
+typedef struct node_plan_buffer_s node_plan_buffer;
+
+// Structure definitions
+/** !
+ * The buffer of one output. It is live from the schedule position of
+ * its node, first, through the position of its last reader, last. An
+ * output nothing reads stays live to the end of the schedule, so the
+ * caller can read it after a run. p_previous is where the output
+ * pointed before it was planned.
+ */
+struct node_plan_buffer_s
+{
+    node *p_node;
+    size_t out_index;
+    size_t first;
+    size_t last;
+    size_t offset;
+    size_t size;
+    void *p_previous;
+};
+
+/** !
+ * Where the outputs of a graph live. Buffers that are never live at the
+ * same time share memory in one arena, so its size is the peak working
+ * set of a run; unaliased_size is what the buffers would take apart.
+ * The arena is aligned within the block that holds it.
+ */
+struct node_plan_s
+{
+    size_t buffer_quantity;
+    size_t arena_size;
+    size_t unaliased_size;
+    void *p_arena;
+    void *_p_block;
+    node_plan_buffer _buffers[];
+};
+
+// Function declarations
+// Planning
+/** !
+ * Plan the buffer of each output with a size, and point the output at
+ * it. The size of an output is the size it was given before planning,
+ * or the size it reported on an earlier run; typed outputs aligned
+ * past NODE_PLAN_ALIGNMENT keep their slots. Liveness follows schedule
+ * order, so once buffers share memory, the graph runs with 
+ * node_graph_execute, and not on an executor; node_graph_update runs
+ * every node, since the memory of clean outputs has been reused. The
+ * plan is kept by the graph, and dropped when the schedule changes.
+ *
+ * @param p_node_graph the node graph
+ * @param pp_plan      result; the plan, or null pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_plan ( node_graph *const p_node_graph, const node_plan **const pp_plan );
+
+// Destructors
+/** !
+ * Drop the plan of a graph. Outputs that point into its arena point
+ * where they did before it was planned; a typed output gets its slot
+ * back, holding the value of the last run.
+ *
+ * @param p_node_graph the node graph
+ *
+ * @return void
+ */
+DLLEXPORT void node_graph_plan_release ( node_graph *const p_node_graph );
@@ -0,0 +1,274 @@
+/** !
+ * Header for versioned snapshots of node graphs
+ *
+ * @file node/snapshot.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+// log submodule
+#include <log/log.h>
+
+// hash cache submodule
+#include <hash_cache/hash.h>
+
+// node module
+#include <node/node.h>
+
+// Readers that may be registered with one graph at a time
+#ifndef NODE_SNAPSHOT_READER_QUANTITY
+    #define NODE_SNAPSHOT_READER_QUANTITY 64
+#endif
+
+// Size of a cache line. Each reader has its own, so readers never write to a line another reader reads
+#ifndef NODE_SNAPSHOT_LINE_SIZE
+    #define NODE_SNAPSHOT_LINE_SIZE 64
+#endif
+
+// Structure declarations
+struct node_snapshot_link_s;
+struct node_snapshot_node_s;
+struct node_snapshot_s;
+struct node_snapshot_reader_s;
+struct node_snapshot_retired_s;
+
+// Type definitions
+typedef struct node_snapshot_link_s node_snapshot_link;
+typedef struct node_snapshot_node_s node_snapshot_node;
+typedef struct node_snapshot_s node_snapshot;
+typedef struct node_snapshot_reader_s node_snapshot_reader;
+typedef struct node_snapshot_retired_s node_snapshot_retired;
+
+// Structure definitions
+/** !
+ * One connection of a snapshot, from output out_index to input in_index,
+ * seen from one of its ends. The node is the node at the other end, or
+ * null pointer for an input nothing feeds.
+ */
+struct node_snapshot_link_s
+{
+    const node_snapshot_node *p_node;
+    size_t out_index;
+    size_t in_index;
+};
+
+/** !
+ * A node, as it was when its snapshot was published. Input i is fed
+ * through in[i], and the inputs each output feeds are the successor
+ * links in out. Index is the place of the node in its snapshot. The
+ * name and the ports of p_node never change once it is built, and the
+ * memory of a removed node stays until its graph is released, so they
+ * can be read through p_node; everything an edit changes is copied
+ * into the snapshot.
+ */
+struct node_snapshot_node_s
+{
+    const node *p_node;
+    const char *p_name;
+    size_t index;
+    size_t in_quantity;
+    size_t out_quantity;
+    size_t successor_quantity;
+    const node_snapshot_link *in;
+    const node_snapshot_link *out;
+};
+
+/** !
+ * An immutable view of a graph. The snapshot, its nodes, its links and
+ * the open addressed table of node indices that finds nodes by name
+ * are one allocation. Version counts the snapshots published by the
+ * graph. Retired is the epoch the snapshot was replaced in, and p_next
+ * links the snapshots that wait to be reclaimed.
+ */
+struct node_snapshot_s
+{
+    size_t version;
+    size_t node_quantity;
+    size_t link_quantity;
+    const node_snapshot_node *p_nodes;
+
+    size_t slot_mask;
+    const size_t *p_slots;
+
+    size_t retired;
+    node_snapshot *p_next;
+};
+
+/** !
+ * A registered reader. Epoch is the epoch the reader entered in, or 0
+ * while it is outside of a snapshot. Only the thread of the reader
+ * writes to it.
+ */
+struct node_snapshot_reader_s
+{
+    _Alignas(NODE_SNAPSHOT_LINE_SIZE) atomic_size_t epoch;
+    atomic_bool used;
+    node_snapshot_domain *p_domain;
+};
+
+/** !
+ * A node removed from its graph in epoch retired. Snapshots published
+ * before it was removed may still point to it.
+ */
+struct node_snapshot_retired_s
+{
+    node *p_node;
+    size_t retired;
+};
+
+/** !
+ * The snapshots of a graph. Readers load p_current without a lock; the
+ * writer publishes a new snapshot by swapping it in, then moves the
+ * epoch forward. A replaced snapshot waits on the retired list until
+ * every reader that could have loaded it has left, and is released by
+ * a later publish or reclaim. Removed nodes wait the same way in 
+ * p_retired_nodes, until the snapshot current when they were removed
+ * has been replaced, and released. Only the writer touches the retired
+ * lists. The domain is aligned within the block that holds it.
+ */
+struct node_snapshot_domain_s
+{
+    _Alignas(NODE_SNAPSHOT_LINE_SIZE) _Atomic(node_snapshot *) p_current;
+    atomic_size_t epoch;
+    size_t version;
+    size_t retired_quantity;
+    node_snapshot *p_retired;
+    size_t retired_node_quantity;
+    size_t retired_node_capacity;
+    node_snapshot_retired *p_retired_nodes;
+    void *_p_block;
+    node_snapshot_reader _readers[NODE_SNAPSHOT_READER_QUANTITY];
+};
+
+// Function declarations
+// Writers
+/** !
+ * Publish a snapshot of a node graph. The nodes and their connections
+ * are copied into a new snapshot, which replaces the current one in
+ * one atomic store; readers see the graph as it was before the call,
+ * or as it is after, never a mix. Then every replaced snapshot no
+ * reader can still hold is released. The first publish makes the
+ * snapshots of the graph, which readers register with. The cost is
+ * proportional to the size of the graph, so writers publish once per
+ * batch of edits. Only the thread that edits the graph may publish.
+ *
+ * @param p_node_graph the node graph
+ * @param pp_snapshot  result; the new snapshot, or null pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_snapshot_publish ( node_graph *const p_node_graph, const node_snapshot **const pp_snapshot );
+
+/** !
+ * Make room to retire one more node of a node graph, so that a node
+ * can be removed without failing after it is taken out of the graph.
+ *
+ * @param p_node_graph the node graph
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_graph_snapshot_reserve ( node_graph *const p_node_graph );
+
+/** !
+ * Retire a node that was removed from a node graph, after making room
+ * with node_graph_snapshot_reserve. A node that owns its memory is 
+ * released once no snapshot can point to it; at once, if the graph 
+ * has no snapshots. Only the thread that edits the graph may retire.
+ *
+ * @param p_node_graph the node graph
+ * @param p_node       the removed node
+ *
+ * @return void
+ */
+DLLEXPORT void node_graph_snapshot_retire ( node_graph *const p_node_graph, node *p_node );
+
+/** !
+ * Release each replaced snapshot of a node graph that no reader can
+ * still hold, and each retired node that no snapshot left can point
+ * to. Only the thread that edits the graph may reclaim.
+ *
+ * @param p_node_graph the node graph
+ *
+ * @return the quantity of snapshots that still wait to be released
+ */
+DLLEXPORT size_t node_graph_snapshot_reclaim ( node_graph *const p_node_graph );
+
+// Readers
+/** !
+ * Register a reader of the snapshots of a node graph. The graph must
+ * have published a snapshot before its readers are registered. Any
+ * thread may register, without a lock.
+ *
+ * @param p_node_graph the node graph
+ * @param pp_reader    result
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_snapshot_reader_register ( node_graph *const p_node_graph, node_snapshot_reader **const pp_reader );
+
+/** !
+ * Unregister a reader. The reader must be outside of a snapshot.
+ *
+ * @param pp_reader pointer to the reader
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_snapshot_reader_unregister ( node_snapshot_reader **const pp_reader );
+
+/** !
+ * Enter the current snapshot of a graph. The snapshot stays valid, and
+ * unchanged, until the reader exits it, however the graph is edited
+ * and published meanwhile. Entering takes no lock, and writes only to
+ * the reader. A reader is in at most one snapshot at a time, and is
+ * used by one thread.
+ *
+ * @param p_reader    the reader
+ * @param pp_snapshot result
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_snapshot_enter ( node_snapshot_reader *const p_reader, const node_snapshot **const pp_snapshot );
+
+/** !
+ * Exit the snapshot a reader entered. The snapshot, and its nodes, may
+ * be released once every reader has exited it.
+ *
+ * @param p_reader the reader
+ *
+ * @return void
+ */
+DLLEXPORT void node_snapshot_exit ( node_snapshot_reader *const p_reader );
+
+// Accessors
+/** !
+ * Get a node of a snapshot by name
+ *
+ * @param p_snapshot the snapshot
+ * @param p_name     the name of the node
+ * @param pp_node    result
+ *
+ * @return 1 on success, 0 if no node of the snapshot has the name
+ */
+DLLEXPORT int node_snapshot_node_get ( const node_snapshot *const p_snapshot, const char *const p_name, const node_snapshot_node **const pp_node );
+
+// Destructors
+/** !
+ * Release the snapshots of a node graph. No reader may be registered.
+ * Releasing a graph releases its snapshots.
+ *
+ * @param p_node_graph the node graph
+ *
+ * @return void
+ */
+DLLEXPORT void node_graph_snapshot_release ( node_graph *const p_node_graph );
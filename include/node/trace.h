@@ -0,0 +1,137 @@
+/** !
+ * Header for tracing node runs
+ *
+ * @file node/trace.h
+ *
+ * @author Jacob Smith
+ */
+
+// Include guard
+#pragma once
+
+// Standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// log submodule
+#include <log/log.h>
+
+// node module
+#include <node/node.h>
+
+// Records each thread keeps, before the oldest are overwritten. A power of two
+#ifndef NODE_TRACE_RING_SIZE
+    #define NODE_TRACE_RING_SIZE 65536
+#endif
+
+// Structure declarations
+struct node_trace_record_s;
+struct node_trace_ring_s;
+
+// Type definitions
+typedef struct node_trace_record_s node_trace_record;
+typedef struct node_trace_ring_s node_trace_ring;
+
+// Structure definitions
+/** !
+ * One run of one node. Times are in nanoseconds on the monotonic
+ * clock, and bytes is the sum of the sizes of the node's outputs.
+ */
+struct node_trace_record_s
+{
+    const char *p_name;
+    uint64_t begin;
+    uint64_t end;
+    size_t bytes;
+};
+
+/** !
+ * The records of one thread. Only its thread writes to it; head counts
+ * every record written, and is published after the record, so a dump
+ * can read the ring without a lock. Rings are kept on a list, and live
+ * as long as the process.
+ */
+struct node_trace_ring_s
+{
+    node_trace_ring *p_next;
+    size_t thread;
+    atomic_size_t head;
+    node_trace_record _records[NODE_TRACE_RING_SIZE];
+};
+
+// Data
+/** !
+ * True while tracing. When the library is built with NODE_TRACE, each
+ * node run tests it once; without NODE_TRACE, nothing is recorded.
+ */
+extern atomic_bool node_trace_active;
+
+// Function declarations
+// Control
+/** !
+ * Start recording node runs. Times in the trace are relative to the
+ * first start.
+ *
+ * @param void
+ *
+ * @return void
+ */
+DLLEXPORT void node_trace_start ( void );
+
+/** !
+ * Stop recording node runs
+ *
+ * @param void
+ *
+ * @return void
+ */
+DLLEXPORT void node_trace_stop ( void );
+
+/** !
+ * Discard every record. No node may be running.
+ *
+ * @param void
+ *
+ * @return void
+ */
+DLLEXPORT void node_trace_clear ( void );
+
+// Recording
+/** !
+ * Read the monotonic clock
+ *
+ * @param void
+ *
+ * @return the time in nanoseconds
+ */
+DLLEXPORT uint64_t node_trace_now ( void );
+
+/** !
+ * Record a run of a node on the ring of the calling thread, which is
+ * made on its first record
+ *
+ * @param p_node the node, after its run
+ * @param begin  the time the run began
+ * @param end    the time the run ended
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_trace_record_run ( const node *const p_node, uint64_t begin, uint64_t end );
+
+// Serialization
+/** !
+ * Write the records of every thread to a file, in the Chrome trace
+ * event format that chrome://tracing and Perfetto open. Node names are
+ * read from the nodes, so their graphs must not have been released.
+ * Records written while the dump reads them are skipped.
+ *
+ * @param p_path path to the file
+ *
+ * @return 1 on success, 0 on error
+ */
+DLLEXPORT int node_trace_dump ( const char *const p_path );
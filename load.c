@@ -0,0 +1,1182 @@
+/** !
+ * Streaming node graph loader
+ *
+ * @file load.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/node.h>
+
+// POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Structure declarations
+struct node_load_text_s;
+struct node_load_s;
+
+// Type definitions
+typedef struct node_load_text_s node_load_text;
+typedef struct node_load_s node_load;
+
+// Structure definitions
+struct node_load_text_s
+{
+    char *p_data;
+    size_t size;
+    size_t capacity;
+};
+
+/** !
+ * The state of a load. The cursor walks a mapped file. Nodes are built
+ * as soon as their object closes; connections are kept as text until
+ * every node is known, since they may come first in the file.
+ */
+struct node_load_s
+{
+    const char *p_base;
+    const char *p;
+    const char *p_end;
+
+    node_arena arena;
+    node_symbol_table symbols;
+
+    node **pp_nodes;
+    size_t node_quantity;
+    size_t node_capacity;
+
+    node_load_text key, name, kind, in, out, data;
+    node_load_text in_types, out_types, type;
+    size_t in_quantity, out_quantity;
+
+    node_load_text connections;
+    size_t connection_quantity;
+};
+
+// Function declarations
+/** !
+ * Append bytes to a text buffer
+ *
+ * @param p_text  the text buffer
+ * @param p_bytes the bytes
+ * @param size    the quantity of bytes
+ *
+ * @return 1 on success, 0 on error
+ */
+int node_load_text_append ( node_load_text *const p_text, const void *const p_bytes, size_t size );
+
+/** !
+ * Skip whitespace, and return the next character without consuming it
+ *
+ * @param p_load the load
+ *
+ * @return the next character, or 0 at the end of the file
+ */
+char node_load_peek ( node_load *const p_load );
+
+/** !
+ * Consume a character, if it is the next character
+ *
+ * @param p_load the load
+ * @param c      the character
+ *
+ * @return 1 if the character was consumed, 0 otherwise
+ */
+int node_load_accept ( node_load *const p_load, char c );
+
+/** !
+ * Decode a json string, and append it to a text buffer with a terminator
+ *
+ * @param p_load the load
+ * @param p_text the text buffer
+ *
+ * @return 1 on success, 0 on error
+ */
+int node_load_string ( node_load *const p_load, node_load_text *const p_text );
+
+/** !
+ * Skip a json value
+ *
+ * @param p_load the load
+ *
+ * @return 1 on success, 0 on error
+ */
+int node_load_skip ( node_load *const p_load );
+
+/** !
+ * Parse a json array of strings into a text buffer. With a buffer of
+ * types, an entry may also be a port with a type, { "name" : "type" },
+ * and the type of each port, or null pointer, is appended to it.
+ *
+ * @param p_load     the load
+ * @param p_text     the text buffer
+ * @param p_types    the buffer of port types, or null pointer
+ * @param p_quantity result; the quantity of strings
+ *
+ * @return 1 on success, 0 on error
+ */
+int node_load_names ( node_load *const p_load, node_load_text *const p_text, node_load_text *const p_types, size_t *const p_quantity );
+
+/** !
+ * Parse a node object, and construct the node
+ *
+ * @param p_load the load
+ *
+ * @return 1 on success, 0 on error
+ */
+int node_load_node ( node_load *const p_load );
+
+/** !
+ * Parse the connections array into text
+ *
+ * @param p_load the load
+ *
+ * @return 1 on success, 0 on error
+ */
+int node_load_connections ( node_load *const p_load );
+
+// Function definitions
+int node_load_text_append ( node_load_text *const p_text, const void *const p_bytes, size_t size )
+{
+
+    // Grow the text buffer
+    if ( p_text->size + size > p_text->capacity )
+    {
+
+        // Initialized data
+        size_t capacity = ( p_text->capacity ) ? p_text->capacity : 256;
+        char *p_data = (void *) 0;
+
+        // Double until the bytes fit
+        while ( p_text->size + size > capacity ) capacity *= 2;
+
+        // Reallocate
+        p_data = NODE_REALLOC(p_text->p_data, capacity);
+
+        // Error check
+        if ( p_data == (void *) 0 ) goto no_mem;
+
+        // Store the allocation
+        p_text->p_data   = p_data,
+        p_text->capacity = capacity;
+    }
+
+    // Copy the bytes
+    memcpy(p_text->p_data + p_text->size, p_bytes, size);
+
+    // Advance the cursor
+    p_text->size += size;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+char node_load_peek ( node_load *const p_load )
+{
+
+    // Skip whitespace
+    while ( p_load->p < p_load->p_end && ( *p_load->p == ' ' || *p_load->p == '\t' || *p_load->p == '\n' || *p_load->p == '\r' ) ) p_load->p++;
+
+    // Done
+    return ( p_load->p < p_load->p_end ) ? *p_load->p : '\0';
+}
+
+int node_load_accept ( node_load *const p_load, char c )
+{
+
+    // Not the next character
+    if ( node_load_peek(p_load) != c ) return 0;
+
+    // Consume the character
+    p_load->p++;
+
+    // Success
+    return 1;
+}
+
+int node_load_string ( node_load *const p_load, node_load_text *const p_text )
+{
+
+    // Opening quote
+    if ( node_load_accept(p_load, '"') == 0 ) goto expected_string;
+
+    // Decode the string
+    while ( p_load->p < p_load->p_end )
+    {
+
+        // Initialized data
+        const char *p_run = p_load->p;
+
+        // Copy a run of plain characters
+        while ( p_load->p < p_load->p_end && *p_load->p != '"' && *p_load->p != '\\' ) p_load->p++;
+        if ( node_load_text_append(p_text, p_run, (size_t) ( p_load->p - p_run )) == 0 ) return 0;
+
+        // Error check
+        if ( p_load->p == p_load->p_end ) break;
+
+        // Closing quote
+        if ( *p_load->p++ == '"' ) return node_load_text_append(p_text, "", 1);
+
+        // Error check
+        if ( p_load->p == p_load->p_end ) break;
+
+        // Escape sequence
+        switch ( *p_load->p++ )
+        {
+            case '"':  if ( node_load_text_append(p_text, "\"", 1) == 0 ) return 0; break;
+            case '\\': if ( node_load_text_append(p_text, "\\", 1) == 0 ) return 0; break;
+            case '/':  if ( node_load_text_append(p_text, "/",  1) == 0 ) return 0; break;
+            case 'b':  if ( node_load_text_append(p_text, "\b", 1) == 0 ) return 0; break;
+            case 'f':  if ( node_load_text_append(p_text, "\f", 1) == 0 ) return 0; break;
+            case 'n':  if ( node_load_text_append(p_text, "\n", 1) == 0 ) return 0; break;
+            case 'r':  if ( node_load_text_append(p_text, "\r", 1) == 0 ) return 0; break;
+            case 't':  if ( node_load_text_append(p_text, "\t", 1) == 0 ) return 0; break;
+            case 'u':
+            {
+
+                // Initialized data
+                unsigned code_point = 0;
+                char _utf8[3] = { 0 };
+                size_t len = 0;
+
+                // Error check
+                if ( p_load->p_end - p_load->p < 4 ) goto unterminated_string;
+
+                // Parse the code point
+                for (int i = 0; i < 4; i++)
+                {
+
+                    // Initialized data
+                    char h = *p_load->p++;
+
+                    // Accumulate
+                    if      ( h >= '0' && h <= '9' ) code_point = ( code_point << 4 ) | (unsigned) ( h - '0' );
+                    else if ( h >= 'a' && h <= 'f' ) code_point = ( code_point << 4 ) | (unsigned) ( h - 'a' + 10 );
+                    else if ( h >= 'A' && h <= 'F' ) code_point = ( code_point << 4 ) | (unsigned) ( h - 'A' + 10 );
+                    else goto bad_escape;
+                }
+
+                // Encode the code point as utf-8. Surrogate halves are kept as they are
+                if      ( code_point < 0x80  ) _utf8[0] = (char) code_point, len = 1;
+                else if ( code_point < 0x800 ) _utf8[0] = (char) ( 0xC0 | ( code_point >> 6 ) ), _utf8[1] = (char) ( 0x80 | ( code_point & 0x3F ) ), len = 2;
+                else                           _utf8[0] = (char) ( 0xE0 | ( code_point >> 12 ) ), _utf8[1] = (char) ( 0x80 | ( ( code_point >> 6 ) & 0x3F ) ), _utf8[2] = (char) ( 0x80 | ( code_point & 0x3F ) ), len = 3;
+
+                // Append the character
+                if ( node_load_text_append(p_text, _utf8, len) == 0 ) return 0;
+
+                // Done
+                break;
+            }
+
+            default:
+                goto bad_escape;
+        }
+    }
+
+    unterminated_string:
+        #ifndef NDEBUG
+            log_error("[node] [load] Unterminated string in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Syntax errors
+        {
+            expected_string:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Expected a string at offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            bad_escape:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Bad escape sequence at offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_load_skip ( node_load *const p_load )
+{
+
+    // Initialized data
+    size_t depth = 0;
+
+    // Skip a value, counting brackets and stepping over strings
+    do
+    {
+
+        // Initialized data
+        char c = node_load_peek(p_load);
+
+        // Error check
+        if ( c == '\0' ) goto unexpected_end;
+
+        // Strategy
+        switch ( c )
+        {
+            case '"':
+
+                // Step over the string
+                for (p_load->p++; p_load->p < p_load->p_end && *p_load->p != '"'; p_load->p++)
+                    if ( *p_load->p == '\\' ) p_load->p++;
+
+                // Error check
+                if ( p_load->p >= p_load->p_end ) goto unexpected_end;
+
+                // Closing quote
+                p_load->p++;
+
+                break;
+
+            case '{': case '[':
+                depth++, p_load->p++;
+                break;
+
+            case '}': case ']':
+
+                // Error check
+                if ( depth == 0 ) goto unexpected_character;
+
+                depth--, p_load->p++;
+                break;
+
+            case ',': case ':':
+
+                // Error check
+                if ( depth == 0 ) goto unexpected_character;
+
+                p_load->p++;
+                break;
+
+            default:
+
+                // Step over a number or a literal
+                while ( p_load->p < p_load->p_end && strchr(" \t\r\n,:]}", *p_load->p) == (void *) 0 ) p_load->p++;
+
+                break;
+        }
+    } while ( depth );
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Syntax errors
+        {
+            unexpected_end:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Unexpected end of file in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            unexpected_character:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Unexpected character at offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_load_names ( node_load *const p_load, node_load_text *const p_text, node_load_text *const p_types, size_t *const p_quantity )
+{
+
+    // Initialized data
+    size_t quantity = 0;
+
+    // Opening bracket
+    if ( node_load_accept(p_load, '[') == 0 ) goto wrong_type;
+
+    // Empty array
+    if ( node_load_accept(p_load, ']') ) goto done;
+
+    // Each name
+    do
+    {
+
+        // Initialized data
+        const node_port_type *p_port_type = (void *) 0;
+
+        // A port with a type
+        if ( p_types && node_load_accept(p_load, '{') )
+        {
+
+            // Parse the name
+            if ( node_load_peek(p_load) != '"' ) goto wrong_port_type;
+            if ( node_load_string(p_load, p_text) == 0 ) return 0;
+
+            // Separator
+            if ( node_load_accept(p_load, ':') == 0 ) goto wrong_port_type;
+
+            // Parse the name of the type
+            p_load->type.size = 0;
+            if ( node_load_peek(p_load) != '"' ) goto wrong_port_type;
+            if ( node_load_string(p_load, &p_load->type) == 0 ) return 0;
+
+            // Closing brace
+            if ( node_load_accept(p_load, '}') == 0 ) goto wrong_port_type;
+
+            // Find the type
+            p_port_type = node_port_type_get(p_load->type.p_data);
+
+            // Error check
+            if ( p_port_type == (void *) 0 ) goto unknown_port_type;
+        }
+
+        // A port
+        else
+        {
+
+            // Type check
+            if ( node_load_peek(p_load) != '"' ) goto wrong_port_type;
+
+            // Parse the name
+            if ( node_load_string(p_load, p_text) == 0 ) return 0;
+        }
+
+        // Store the type
+        if ( p_types )
+            if ( node_load_text_append(p_types, &p_port_type, sizeof(const node_port_type *)) == 0 ) return 0;
+
+        // Count
+        quantity++;
+
+    } while ( node_load_accept(p_load, ',') );
+
+    // Closing bracket
+    if ( node_load_accept(p_load, ']') == 0 ) goto wrong_type;
+
+    done:
+
+    // Return the quantity to the caller
+    *p_quantity = quantity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Node errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Property \"in\" and \"out\" must be of type [ array ] at offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Each port must be of type [ string ] or { \"name\" : \"type\" } at offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Unregistered port type \"%s\" at offset %zu in call to function \"%s\"\n", p_load->type.p_data, (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_load_node ( node_load *const p_load )
+{
+
+    // Initialized data
+    node *p_node = (void *) 0;
+    json_value *p_data = (void *) 0;
+    const node_data_kind *p_kind = (void *) 0;
+    char *p_text = (void *) 0;
+    size_t id = 0;
+
+    // Reset the scratch buffers
+    p_load->name.size = 0,
+    p_load->kind.size = 0,
+    p_load->in.size   = 0,
+    p_load->out.size  = 0,
+    p_load->in_types.size  = 0,
+    p_load->out_types.size = 0,
+    p_load->in_quantity  = 0,
+    p_load->out_quantity = 0;
+
+    // Parse the name
+    if ( node_load_string(p_load, &p_load->name) == 0 ) return 0;
+    if ( node_load_accept(p_load, ':') == 0 ) goto expected_colon;
+
+    // Opening brace
+    if ( node_load_accept(p_load, '{') == 0 ) goto wrong_type;
+
+    // Parse each property
+    if ( node_load_peek(p_load) != '}' ) do
+    {
+
+        // Initialized data
+        int result = 1;
+
+        // Parse the key
+        p_load->key.size = 0;
+        if ( node_load_peek(p_load) != '"' ) goto expected_string;
+        if ( node_load_string(p_load, &p_load->key) == 0 ) goto failed_to_parse_property;
+
+        // Separator
+        if ( node_load_accept(p_load, ':') == 0 ) goto expected_colon;
+
+        // Strategy
+        if      ( strcmp(p_load->key.p_data, "in")   == 0 ) result = node_load_names(p_load, &p_load->in, &p_load->in_types, &p_load->in_quantity);
+        else if ( strcmp(p_load->key.p_data, "out")  == 0 ) result = node_load_names(p_load, &p_load->out, &p_load->out_types, &p_load->out_quantity);
+        else if ( strcmp(p_load->key.p_data, "kind") == 0 )
+        {
+
+            // Type check
+            if ( node_load_peek(p_load) != '"' ) goto wrong_kind_type;
+
+            // Parse the name of the kind
+            p_load->kind.size = 0;
+            result = node_load_string(p_load, &p_load->kind);
+        }
+        else if ( strcmp(p_load->key.p_data, "data") == 0 )
+        {
+
+            // Initialized data
+            const char *p_start = (node_load_peek(p_load), p_load->p);
+
+            // Find the end of the value
+            result = node_load_skip(p_load);
+
+            // Copy the value, and parse it on its own
+            if ( result )
+            {
+                p_load->data.size = 0;
+                result = node_load_text_append(&p_load->data, p_start, (size_t) ( p_load->p - p_start )) &&
+                         node_load_text_append(&p_load->data, "", 1);
+                if ( result ) if ( p_data ) json_value_free(p_data), p_data = (void *) 0;
+                if ( result ) result = json_value_parse(p_load->data.p_data, 0, &p_data);
+            }
+        }
+        else result = node_load_skip(p_load);
+
+        // Error check
+        if ( result == 0 ) goto failed_to_parse_property;
+
+    } while ( node_load_accept(p_load, ',') );
+
+    // Closing brace
+    if ( node_load_accept(p_load, '}') == 0 ) goto expected_brace;
+
+    // Find the kind of the node data
+    if ( p_load->kind.size )
+    {
+
+        // Find the kind
+        p_kind = node_data_kind_get(p_load->kind.p_data);
+
+        // Error check
+        if ( p_kind == (void *) 0 ) goto unknown_kind;
+    }
+
+    // Allocate the node, its ports, and its names in one block
+    if ( node_create(&p_node, &p_load->arena, p_load->in_quantity, p_load->out_quantity, p_load->name.size + p_load->in.size + p_load->out.size) == 0 ) goto failed_to_create_node;
+
+    // The name text follows the last output port
+    p_text = (char *) (p_node->out + p_node->out_quantity);
+
+    // Copy the names
+    memcpy(p_text, p_load->name.p_data, p_load->name.size);
+    if ( p_load->in.size  ) memcpy(p_text + p_load->name.size, p_load->in.p_data, p_load->in.size);
+    if ( p_load->out.size ) memcpy(p_text + p_load->name.size + p_load->in.size, p_load->out.p_data, p_load->out.size);
+
+    // Store the name
+    p_node->p_name = p_text;
+    p_text += p_load->name.size;
+
+    // Store the name of each port
+    for (size_t i = 0; i < p_node->in_quantity; i++)  p_node->in[i].p_name  = p_text, p_text += strlen(p_text) + 1;
+    for (size_t i = 0; i < p_node->out_quantity; i++) p_node->out[i].p_name = p_text, p_text += strlen(p_text) + 1;
+
+    // Store the type of each port. A typed output holds a value of its type
+    for (size_t i = 0; i < p_node->in_quantity; i++)  memcpy(&p_node->in[i].p_type, p_load->in_types.p_data + i * sizeof(const node_port_type *), sizeof(const node_port_type *));
+    for (size_t i = 0; i < p_node->out_quantity; i++)
+    {
+        memcpy(&p_node->out[i].p_type, p_load->out_types.p_data + i * sizeof(const node_port_type *), sizeof(const node_port_type *));
+        if ( p_node->out[i].p_type ) p_node->out[i].size = p_node->out[i].p_type->size;
+    }
+
+    // Store the node data
+    p_node->value      = p_data,
+    p_node->owns_value = ( p_data != (void *) 0 ),
+    p_node->p_kind     = p_kind,
+    p_data             = (void *) 0;
+
+    // Construct the graph nested in the node data, if there is one
+    if ( node_subgraph_construct(p_node) == 0 ) goto failed_to_construct_subgraph;
+
+    // Intern the name of the node
+    if ( node_symbol_table_intern(&p_load->symbols, p_node->p_name, strlen(p_node->p_name), &id) == 0 ) goto failed_to_intern;
+
+    // Error check
+    if ( p_load->symbols.p_symbols[id].p_node ) goto duplicate_node;
+
+    // Bind the symbol to the node
+    p_node->id = id;
+    p_load->symbols.p_symbols[id].p_node = p_node;
+
+    // Intern the name of each port
+    for (size_t i = 0; i < p_node->in_quantity; i++)
+        if ( node_symbol_table_intern(&p_load->symbols, p_node->in[i].p_name, strlen(p_node->in[i].p_name), &p_node->in[i].id) == 0 ) goto failed_to_intern;
+    for (size_t i = 0; i < p_node->out_quantity; i++)
+        if ( node_symbol_table_intern(&p_load->symbols, p_node->out[i].p_name, strlen(p_node->out[i].p_name), &p_node->out[i].id) == 0 ) goto failed_to_intern;
+
+    // Grow the node list
+    if ( p_load->node_quantity == p_load->node_capacity )
+    {
+
+        // Initialized data
+        size_t capacity = ( p_load->node_capacity ) ? p_load->node_capacity * 2 : 64;
+        node **pp_nodes = NODE_REALLOC(p_load->pp_nodes, capacity * sizeof(node *));
+
+        // Error check
+        if ( pp_nodes == (void *) 0 ) goto no_mem;
+
+        // Store the allocation
+        p_load->pp_nodes      = pp_nodes,
+        p_load->node_capacity = capacity;
+    }
+
+    // Store the index of the node
+    p_node->index = p_load->node_quantity;
+
+    // Store the node
+    p_load->pp_nodes[p_load->node_quantity++] = p_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Syntax errors
+        {
+            expected_string:
+            expected_colon:
+            expected_brace:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Unexpected character at offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Release the node data
+                if ( p_data ) json_value_free(p_data);
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Node \"%s\" must be of type [ object ] in call to function \"%s\"\n", p_load->name.p_data, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_kind_type:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Property \"kind\" of node \"%s\" must be of type [ string ] in call to function \"%s\"\n", p_load->name.p_data, __FUNCTION__);
+                #endif
+
+                // Release the node data
+                if ( p_data ) json_value_free(p_data);
+
+                // Error
+                return 0;
+
+            unknown_kind:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Node \"%s\" has unregistered kind \"%s\" in call to function \"%s\"\n", p_load->name.p_data, p_load->kind.p_data, __FUNCTION__);
+                #endif
+
+                // Release the node data
+                if ( p_data ) json_value_free(p_data);
+
+                // Error
+                return 0;
+
+            failed_to_parse_property:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Failed to parse a property of node \"%s\" in call to function \"%s\"\n", p_load->name.p_data, __FUNCTION__);
+                #endif
+
+                // Release the node data
+                if ( p_data ) json_value_free(p_data);
+
+                // Error
+                return 0;
+
+            failed_to_create_node:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Failed to create node \"%s\" in call to function \"%s\"\n", p_load->name.p_data, __FUNCTION__);
+                #endif
+
+                // Release the node data
+                if ( p_data ) json_value_free(p_data);
+
+                // Error
+                return 0;
+
+            failed_to_intern:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Failed to intern the names of node \"%s\" in call to function \"%s\"\n", p_load->name.p_data, __FUNCTION__);
+                #endif
+
+                // Release the subgraph
+                if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+                // Release the node data
+                if ( p_node->value ) json_value_free(p_node->value);
+
+                // Error
+                return 0;
+
+            failed_to_construct_subgraph:
+
+                // Release the subgraph
+                if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+                // Release the node data
+                if ( p_node->value ) json_value_free(p_node->value);
+
+                // Error
+                return 0;
+
+            duplicate_node:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Node \"%s\" is defined more than once in call to function \"%s\"\n", p_node->p_name, __FUNCTION__);
+                #endif
+
+                // Release the subgraph
+                if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+                // Release the node data
+                if ( p_node->value ) json_value_free(p_node->value);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the subgraph
+                if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+                // Release the node data
+                if ( p_node->value ) json_value_free(p_node->value);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_load_connections ( node_load *const p_load )
+{
+
+    // Opening bracket
+    if ( node_load_accept(p_load, '[') == 0 ) goto wrong_type;
+
+    // Empty array
+    if ( node_load_accept(p_load, ']') ) return 1;
+
+    // Each connection
+    do
+    {
+
+        // Initialized data
+        size_t quantity = 0;
+
+        // Parse the pair of ports
+        if ( node_load_peek(p_load) != '[' ) goto wrong_connection_type;
+        if ( node_load_names(p_load, &p_load->connections, (void *) 0, &quantity) == 0 ) return 0;
+
+        // Error check
+        if ( quantity != 2 ) goto wrong_connection_size;
+
+        // Count
+        p_load->connection_quantity++;
+
+    } while ( node_load_accept(p_load, ',') );
+
+    // Closing bracket
+    if ( node_load_accept(p_load, ']') == 0 ) goto wrong_type;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Connection errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Property \"connections\" must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_connection_type:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Each connection must be of type [ array ] at offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_connection_size:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Each connection must have exactly two ports, near offset %zu in call to function \"%s\"\n", (size_t) ( p_load->p - p_load->p_base ), __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_load ( node_graph **pp_node_graph, const char *const p_path )
+{
+
+    // Argument check
+    if ( pp_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_path        == (void *) 0 ) goto no_path;
+
+    // Initialized data
+    node_load _load = { 0 };
+    node_graph *p_node_graph = (void *) 0;
+    struct stat _stat = { 0 };
+    void *p_base = (void *) 0;
+    const char *p_fed = (void *) 0;
+    size_t size = 0;
+    bool has_nodes = false;
+    int fd = open(p_path, O_RDONLY);
+
+    // Error check
+    if ( fd == -1 ) goto failed_to_open_file;
+    if ( fstat(fd, &_stat) == -1 ) { close(fd); goto failed_to_stat_file; }
+
+    // Store the size
+    size = (size_t) _stat.st_size;
+
+    // Error check
+    if ( size == 0 ) { close(fd); goto no_nodes; }
+
+    // Map the file
+    p_base = mmap((void *) 0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping holds its own reference to the file
+    close(fd);
+
+    // Error check
+    if ( p_base == MAP_FAILED ) goto failed_to_map_file;
+
+    // The file is read once, front to back
+    madvise(p_base, size, MADV_SEQUENTIAL);
+
+    // Point the cursor at the file
+    _load.p_base = _load.p = p_base,
+    _load.p_end  = _load.p_base + size;
+
+    // Construct an interner for node and port names
+    if ( node_symbol_table_construct(&_load.symbols, 256) == 0 ) goto failed;
+
+    // Parse the top level object
+    if ( node_load_accept(&_load, '{') == 0 ) goto wrong_type;
+    if ( node_load_peek(&_load) != '}' ) do
+    {
+
+        // Parse the key
+        _load.key.size = 0;
+        if ( node_load_string(&_load, &_load.key) == 0 ) goto failed;
+        if ( node_load_accept(&_load, ':') == 0 ) goto syntax_error;
+
+        // Nodes
+        if ( strcmp(_load.key.p_data, "nodes") == 0 )
+        {
+
+            // Error check
+            if ( has_nodes ) goto syntax_error;
+
+            // Opening brace
+            if ( node_load_accept(&_load, '{') == 0 ) goto wrong_nodes_type;
+
+            // Each node
+            if ( node_load_peek(&_load) != '}' ) do
+            {
+                if ( node_load_node(&_load) == 0 ) goto failed;
+            } while ( node_load_accept(&_load, ',') );
+
+            // Closing brace
+            if ( node_load_accept(&_load, '}') == 0 ) goto syntax_error;
+
+            // Done
+            has_nodes = true;
+        }
+
+        // Connections
+        else if ( strcmp(_load.key.p_data, "connections") == 0 )
+        {
+            if ( node_load_connections(&_load) == 0 ) goto failed;
+        }
+
+        // Anything else
+        else if ( node_load_skip(&_load) == 0 ) goto failed;
+
+    } while ( node_load_accept(&_load, ',') );
+
+    // Closing brace
+    if ( node_load_accept(&_load, '}') == 0 ) goto syntax_error;
+
+    // Error check
+    if ( has_nodes == false ) goto missing_nodes_value;
+    if ( _load.node_quantity == 0 ) goto no_nodes;
+
+    // Allocate a node graph
+    if ( node_graph_create(&p_node_graph, _load.node_quantity) == 0 ) goto failed;
+
+    // Move the nodes, their memory, and their names into the graph
+    memcpy(p_node_graph->_p_nodes, _load.pp_nodes, _load.node_quantity * sizeof(node *));
+    p_node_graph->arena   = _load.arena,
+    p_node_graph->symbols = _load.symbols;
+    _load.arena   = (node_arena) { 0 },
+    _load.symbols = (node_symbol_table) { 0 };
+
+    // Make each connection
+    for (size_t i = 0, offset = 0; i < _load.connection_quantity; i++)
+    {
+
+        // Initialized data
+        const char *p_in  = _load.connections.p_data + offset,
+                   *p_out = p_in + strlen(p_in) + 1;
+        node *p_node_in  = (void *) 0,
+             *p_node_out = (void *) 0;
+        size_t j = 0, k = 0;
+
+        // Advance the cursor
+        offset = (size_t) ( p_out + strlen(p_out) + 1 - _load.connections.p_data );
+
+        // Resolve each side of the connection to a node and a port index
+        if ( node_graph_port_resolve(p_node_graph, p_in, false, &p_node_in, &j) == 0 ) goto failed_to_connect;
+        if ( node_graph_port_resolve(p_node_graph, p_out, true, &p_node_out, &k) == 0 ) goto failed_to_connect;
+
+        // Error check
+        if ( p_node_out->in[k].p_in ) { p_fed = p_out; goto input_fed_twice; }
+
+        // Make the connection to the output. An output feeds every input connected to it
+        p_node_out->in[k].p_in      = p_node_in,
+        p_node_out->in[k].out_index = j;
+    }
+
+    // Construct the node data, in parallel
+    if ( node_graph_data_construct(p_node_graph, 0) == 0 ) goto failed;
+
+    // Allocate the values of typed outputs
+    if ( node_graph_values_allocate(p_node_graph, 0) == 0 ) goto failed;
+
+    // Release the scratch memory
+    if ( _load.pp_nodes          ) _load.pp_nodes          = NODE_REALLOC(_load.pp_nodes, 0);
+    if ( _load.name.p_data       ) _load.name.p_data       = NODE_REALLOC(_load.name.p_data, 0);
+    if ( _load.kind.p_data       ) _load.kind.p_data       = NODE_REALLOC(_load.kind.p_data, 0);
+    if ( _load.in.p_data         ) _load.in.p_data         = NODE_REALLOC(_load.in.p_data, 0);
+    if ( _load.out.p_data        ) _load.out.p_data        = NODE_REALLOC(_load.out.p_data, 0);
+    if ( _load.in_types.p_data   ) _load.in_types.p_data   = NODE_REALLOC(_load.in_types.p_data, 0);
+    if ( _load.out_types.p_data  ) _load.out_types.p_data  = NODE_REALLOC(_load.out_types.p_data, 0);
+    if ( _load.type.p_data       ) _load.type.p_data       = NODE_REALLOC(_load.type.p_data, 0);
+    if ( _load.data.p_data       ) _load.data.p_data       = NODE_REALLOC(_load.data.p_data, 0);
+    if ( _load.connections.p_data) _load.connections.p_data= NODE_REALLOC(_load.connections.p_data, 0);
+    if ( _load.key.p_data        ) _load.key.p_data        = NODE_REALLOC(_load.key.p_data, 0);
+
+    // Unmap the file
+    munmap(p_base, size);
+
+    // Return a pointer to the caller
+    *pp_node_graph = p_node_graph;
+
+    // Success
+    return 1;
+
+    wrong_type:
+    wrong_nodes_type:
+    syntax_error:
+        #ifndef NDEBUG
+            log_error("[node] [load] Unexpected character at offset %zu of \"%s\" in call to function \"%s\"\n", (size_t) ( _load.p - _load.p_base ), p_path, __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto failed;
+
+    missing_nodes_value:
+        #ifndef NDEBUG
+            log_error("[node] [load] \"%s\" has no \"nodes\" property in call to function \"%s\"\n", p_path, __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto failed;
+
+    input_fed_twice:
+        #ifndef NDEBUG
+            log_error("[node] [load] Input \"%s\" is fed by more than one connection in call to function \"%s\"\n", p_fed, __FUNCTION__);
+        #else
+            (void) p_fed;
+        #endif
+
+        // Fall through
+        goto failed;
+
+    failed_to_connect:
+    failed:
+
+        // Release the nodes that were not moved into a graph
+        if ( p_node_graph ) node_graph_destroy(&p_node_graph);
+        else
+        {
+            for (size_t i = 0; i < _load.node_quantity; i++)
+            {
+                if ( _load.pp_nodes[i]->p_subgraph ) node_graph_destroy(&_load.pp_nodes[i]->p_subgraph);
+                if ( _load.pp_nodes[i]->value      ) json_value_free(_load.pp_nodes[i]->value);
+            }
+            node_arena_release(&_load.arena);
+            if ( _load.symbols.p_symbols ) _load.symbols.p_symbols = NODE_REALLOC(_load.symbols.p_symbols, 0);
+            if ( _load.symbols.p_slots   ) _load.symbols.p_slots   = NODE_REALLOC(_load.symbols.p_slots, 0);
+        }
+
+        // Release the scratch memory
+        if ( _load.pp_nodes          ) _load.pp_nodes          = NODE_REALLOC(_load.pp_nodes, 0);
+        if ( _load.name.p_data       ) _load.name.p_data       = NODE_REALLOC(_load.name.p_data, 0);
+        if ( _load.kind.p_data       ) _load.kind.p_data       = NODE_REALLOC(_load.kind.p_data, 0);
+        if ( _load.in.p_data         ) _load.in.p_data         = NODE_REALLOC(_load.in.p_data, 0);
+        if ( _load.out.p_data        ) _load.out.p_data        = NODE_REALLOC(_load.out.p_data, 0);
+        if ( _load.in_types.p_data   ) _load.in_types.p_data   = NODE_REALLOC(_load.in_types.p_data, 0);
+        if ( _load.out_types.p_data  ) _load.out_types.p_data  = NODE_REALLOC(_load.out_types.p_data, 0);
+        if ( _load.type.p_data       ) _load.type.p_data       = NODE_REALLOC(_load.type.p_data, 0);
+        if ( _load.data.p_data       ) _load.data.p_data       = NODE_REALLOC(_load.data.p_data, 0);
+        if ( _load.connections.p_data) _load.connections.p_data= NODE_REALLOC(_load.connections.p_data, 0);
+        if ( _load.key.p_data        ) _load.key.p_data        = NODE_REALLOC(_load.key.p_data, 0);
+
+        // Unmap the file
+        munmap(p_base, size);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Null pointer provided for parameter \"pp_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[node] [load] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            no_nodes:
+                #ifndef NDEBUG
+                    log_error("[node] [load] \"%s\" has no nodes in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // The file may not be mapped yet
+                if ( p_base ) goto failed;
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_stat_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to stat file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_map_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to map file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,986 @@
+/** !
+ * Content addressed memoization of node outputs
+ *
+ * @file memo.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/memo.h>
+
+// Preprocessor definitions
+#define NODE_MEMO_ALIGN(x) ( ( (x) + 15 ) & ~ (size_t) 15 )
+
+// Function definitions
+hash64 node_memo_mix ( hash64 h, hash64 v )
+{
+
+    // Initialized data
+    hash64 _pair[2] = { h, v };
+
+    // Success
+    return hash_fnv64(_pair, sizeof(_pair));
+}
+
+hash64 node_memo_json_hash ( const json_value *const p_value )
+{
+
+    // Initialized data
+    hash64 h = (hash64) p_value->type + 1;
+
+    // Strategy
+    switch ( p_value->type )
+    {
+        case JSON_VALUE_BOOLEAN:
+            return node_memo_mix(h, (hash64) p_value->boolean);
+
+        case JSON_VALUE_INTEGER:
+            return node_memo_mix(h, (hash64) p_value->integer);
+
+        case JSON_VALUE_NUMBER:
+            return node_memo_mix(h, hash_fnv64(&p_value->number, sizeof(p_value->number)));
+
+        case JSON_VALUE_STRING:
+            return node_memo_mix(h, hash_fnv64(p_value->string, strlen(p_value->string)));
+
+        case JSON_VALUE_ARRAY:
+        {
+
+            // Initialized data
+            size_t quantity = array_size(p_value->list);
+
+            // Hash the elements in order
+            for (size_t i = 0; i < quantity; i++)
+            {
+
+                // Initialized data
+                json_value *p_element = (void *) 0;
+
+                // Store the element
+                array_index(p_value->list, (signed long long) i, (void **) &p_element);
+
+                // Accumulate
+                h = node_memo_mix(h, node_memo_json_hash(p_element));
+            }
+
+            // Done
+            return h;
+        }
+
+        case JSON_VALUE_OBJECT:
+        {
+
+            // Initialized data
+            size_t quantity = dict_keys(p_value->object, 0);
+            const char **pp_keys = ( quantity ) ? NODE_REALLOC(0, quantity * sizeof(const char *)) : (void *) 0;
+            hash64 sum = 0;
+
+            // Error check. Hash the object by its size alone
+            if ( quantity && pp_keys == (void *) 0 ) return node_memo_mix(h, quantity);
+
+            // Get the keys
+            if ( quantity ) dict_keys(p_value->object, pp_keys);
+
+            // Sum the properties, so that key order does not matter
+            for (size_t i = 0; i < quantity; i++)
+                sum += node_memo_mix(hash_fnv64(pp_keys[i], strlen(pp_keys[i])), node_memo_json_hash(dict_get(p_value->object, pp_keys[i])));
+
+            // Release memory
+            if ( pp_keys ) pp_keys = NODE_REALLOC(pp_keys, 0);
+
+            // Done
+            return node_memo_mix(h, sum);
+        }
+
+        default:
+            return h;
+    }
+}
+
+int node_memo_key ( node *const p_node, hash64 *const p_key )
+{
+
+    // Hash the name and data of the node, once
+    if ( p_node->data_hash == 0 )
+    {
+        p_node->data_hash = hash_fnv64(p_node->p_name, strlen(p_node->p_name));
+        if ( p_node->value ) p_node->data_hash = node_memo_mix(p_node->data_hash, node_memo_json_hash(p_node->value));
+        if ( p_node->data_hash == 0 ) p_node->data_hash = 1;
+    }
+
+    // Initialized data
+    hash64 key = p_node->data_hash;
+
+    // Mix in the hash of each input
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+    {
+
+        // Unconnected input
+        if ( p_node->in[k].p_in == (void *) 0 ) { key = node_memo_mix(key, k); continue; }
+
+        // Initialized data
+        hash64 input_hash = p_node->in[k].p_in->out[p_node->in[k].out_index].hash;
+
+        // An input with no hash can not be keyed
+        if ( input_hash == 0 ) return 0;
+
+        // Accumulate
+        key = node_memo_mix(key, input_hash);
+    }
+
+    // Return the key to the caller
+    *p_key = ( key ) ? key : 1;
+
+    // Success
+    return 1;
+}
+
+void *node_memo_entry_output ( node_memo_entry *const p_entry, size_t j )
+{
+
+    // Initialized data
+    size_t offset = NODE_MEMO_ALIGN(sizeof(node_memo_entry) + ( p_entry->out_quantity * sizeof(size_t) ));
+
+    // Step over each earlier output
+    for (size_t i = 0; i < j; i++) offset += NODE_MEMO_ALIGN(p_entry->_sizes[i]);
+
+    // Success
+    return ( p_entry->_sizes[j] ) ? (char *) p_entry + offset : (void *) 0;
+}
+
+int node_memo_entry_create ( node_memo_entry **const pp_entry, hash64 key, size_t out_quantity, const size_t *const p_sizes )
+{
+
+    // Initialized data
+    size_t size = NODE_MEMO_ALIGN(sizeof(node_memo_entry) + ( out_quantity * sizeof(size_t) ));
+    node_memo_entry *p_entry = (void *) 0;
+
+    // Measure the outputs
+    for (size_t j = 0; j < out_quantity; j++) size += NODE_MEMO_ALIGN(p_sizes[j]);
+
+    // Allocate the entry
+    p_entry = NODE_REALLOC(0, size);
+
+    // Error check
+    if ( p_entry == (void *) 0 ) goto no_mem;
+
+    // Populate the entry
+    *p_entry = (node_memo_entry)
+    {
+        .key          = key,
+        .size         = size,
+        .out_quantity = out_quantity
+    };
+    for (size_t j = 0; j < out_quantity; j++) p_entry->_sizes[j] = p_sizes[j];
+
+    // Return a pointer to the caller
+    *pp_entry = p_entry;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+node_memo_entry *node_memo_find ( const node_memo *const p_node_memo, hash64 key )
+{
+
+    // Walk the chain
+    for (node_memo_entry *p_entry = p_node_memo->pp_buckets[key & ( p_node_memo->bucket_quantity - 1 )]; p_entry; p_entry = p_entry->p_chain)
+        if ( p_entry->key == key ) return p_entry;
+
+    // Not found
+    return (void *) 0;
+}
+
+void node_memo_unlink ( node_memo *const p_node_memo, node_memo_entry *const p_entry )
+{
+
+    // Remove the entry from the use list
+    if ( p_entry->p_prev ) p_entry->p_prev->p_next = p_entry->p_next;
+    else                   p_node_memo->p_head     = p_entry->p_next;
+    if ( p_entry->p_next ) p_entry->p_next->p_prev = p_entry->p_prev;
+    else                   p_node_memo->p_tail     = p_entry->p_prev;
+
+    // Clear the links
+    p_entry->p_prev = p_entry->p_next = (void *) 0;
+}
+
+void node_memo_touch ( node_memo *const p_node_memo, node_memo_entry *const p_entry )
+{
+
+    // Fast exit
+    if ( p_node_memo->p_head == p_entry ) return;
+
+    // Remove the entry from the use list
+    if ( p_entry->p_prev || p_entry->p_next || p_node_memo->p_tail == p_entry ) node_memo_unlink(p_node_memo, p_entry);
+
+    // Add the entry to the front of the use list
+    p_entry->p_next = p_node_memo->p_head;
+    if ( p_node_memo->p_head ) p_node_memo->p_head->p_prev = p_entry;
+    p_node_memo->p_head = p_entry;
+    if ( p_node_memo->p_tail == (void *) 0 ) p_node_memo->p_tail = p_entry;
+}
+
+void node_memo_evict ( node_memo *const p_node_memo )
+{
+
+    // Initialized data
+    node_memo_entry *p_entry = p_node_memo->p_tail;
+
+    // Evict the least recently used entries that are not pinned
+    while ( p_node_memo->used > p_node_memo->capacity && p_entry )
+    {
+
+        // Initialized data
+        node_memo_entry *p_prev = p_entry->p_prev;
+
+        // Skip pinned entries
+        if ( p_entry->pins ) { p_entry = p_prev; continue; }
+
+        // Remove the entry from its chain
+        for (node_memo_entry **pp = &p_node_memo->pp_buckets[p_entry->key & ( p_node_memo->bucket_quantity - 1 )]; *pp; pp = &(*pp)->p_chain)
+            if ( *pp == p_entry ) { *pp = p_entry->p_chain; break; }
+
+        // Remove the entry from the use list
+        node_memo_unlink(p_node_memo, p_entry);
+
+        // Account for the entry
+        p_node_memo->used -= p_entry->size,
+        p_node_memo->entry_quantity--,
+        p_node_memo->evictions++;
+
+        // Release the entry
+        p_entry = NODE_REALLOC(p_entry, 0);
+
+        // Step to the next entry
+        p_entry = p_prev;
+    }
+}
+
+int node_memo_insert ( node_memo *const p_node_memo, node_memo_entry **const pp_entry )
+{
+
+    // Initialized data
+    node_memo_entry *p_entry = *pp_entry,
+                    *p_found = node_memo_find(p_node_memo, p_entry->key);
+
+    // Another run stored the same key first. Keep that entry
+    if ( p_found )
+    {
+        p_entry = NODE_REALLOC(p_entry, 0);
+        *pp_entry = p_found;
+        node_memo_touch(p_node_memo, p_found);
+        return 1;
+    }
+
+    // Grow the table
+    if ( p_node_memo->entry_quantity >= p_node_memo->bucket_quantity )
+    {
+
+        // Initialized data
+        size_t bucket_quantity = p_node_memo->bucket_quantity * 2;
+        node_memo_entry **pp_buckets = NODE_REALLOC(0, bucket_quantity * sizeof(node_memo_entry *));
+
+        // Error check
+        if ( pp_buckets == (void *) 0 ) goto no_mem;
+
+        // Initialize memory
+        memset(pp_buckets, 0, bucket_quantity * sizeof(node_memo_entry *));
+
+        // Rehash each entry
+        for (size_t i = 0; i < p_node_memo->bucket_quantity; i++)
+            for (node_memo_entry *p = p_node_memo->pp_buckets[i], *p_chain = (void *) 0; p; p = p_chain)
+                p_chain = p->p_chain,
+                p->p_chain = pp_buckets[p->key & ( bucket_quantity - 1 )],
+                pp_buckets[p->key & ( bucket_quantity - 1 )] = p;
+
+        // Store the table
+        p_node_memo->pp_buckets = NODE_REALLOC(p_node_memo->pp_buckets, 0);
+        p_node_memo->pp_buckets      = pp_buckets,
+        p_node_memo->bucket_quantity = bucket_quantity;
+    }
+
+    // Add the entry to its chain
+    p_entry->p_chain = p_node_memo->pp_buckets[p_entry->key & ( p_node_memo->bucket_quantity - 1 )];
+    p_node_memo->pp_buckets[p_entry->key & ( p_node_memo->bucket_quantity - 1 )] = p_entry;
+
+    // Add the entry to the front of the use list
+    p_entry->p_prev = p_entry->p_next = (void *) 0;
+    node_memo_touch(p_node_memo, p_entry);
+
+    // Account for the entry
+    p_node_memo->used += p_entry->size,
+    p_node_memo->entry_quantity++;
+
+    // Make room
+    node_memo_evict(p_node_memo);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the entry
+                p_entry = NODE_REALLOC(p_entry, 0);
+                *pp_entry = (void *) 0;
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_memo_pin ( node *const p_node, node_memo_entry *const p_entry )
+{
+
+    // Keep the outputs of the node before they first point into an entry
+    if ( p_node->p_memo_entry == (void *) 0 && p_entry )
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+            p_node->out[j].own_value = p_node->out[j].value,
+            p_node->out[j].own_size  = p_node->out[j].size;
+
+    // Give the outputs back once the node no longer points into an entry
+    if ( p_node->p_memo_entry && p_entry == (void *) 0 )
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+            p_node->out[j].value = p_node->out[j].own_value,
+            p_node->out[j].size  = p_node->out[j].own_size;
+
+    // Release the entry the node pointed into before
+    if ( p_node->p_memo_entry ) p_node->p_memo_entry->pins--;
+
+    // Pin the new entry
+    if ( p_entry ) p_entry->pins++;
+
+    // Store the entry
+    p_node->p_memo_entry = p_entry;
+}
+
+int node_memo_construct ( node_memo **const pp_node_memo, size_t capacity )
+{
+
+    // Argument check
+    if ( pp_node_memo == (void *) 0 ) goto no_node_memo;
+
+    // Initialized data
+    node_memo *p_node_memo = NODE_REALLOC(0, sizeof(node_memo));
+
+    // Error check
+    if ( p_node_memo == (void *) 0 ) goto no_mem;
+
+    // Populate the memo
+    *p_node_memo = (node_memo)
+    {
+        .capacity        = capacity,
+        .bucket_quantity = 64,
+        .pp_buckets      = NODE_REALLOC(0, 64 * sizeof(node_memo_entry *))
+    };
+
+    // Error check
+    if ( p_node_memo->pp_buckets == (void *) 0 ) goto no_buckets;
+
+    // Initialize memory
+    memset(p_node_memo->pp_buckets, 0, 64 * sizeof(node_memo_entry *));
+
+    // Construct a lock
+    if ( mutex_create(&p_node_memo->_lock) == 0 ) goto failed_to_create_mutex;
+
+    // Return a pointer to the caller
+    *pp_node_memo = p_node_memo;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_memo:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"pp_node_memo\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Sync errors
+        {
+            failed_to_create_mutex:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Failed to create mutex in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                p_node_memo->pp_buckets = NODE_REALLOC(p_node_memo->pp_buckets, 0);
+                p_node_memo = NODE_REALLOC(p_node_memo, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_buckets:
+
+                // Release memory
+                p_node_memo = NODE_REALLOC(p_node_memo, 0);
+
+                // Fall through
+                goto no_mem;
+
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_memo_run ( node_memo *const p_node_memo, node *const p_node )
+{
+
+    // Argument check
+    if ( p_node_memo == (void *) 0 ) goto no_node_memo;
+    if ( p_node      == (void *) 0 ) goto no_node;
+
+    // Initialized data
+    node_memo_entry *p_entry = (void *) 0;
+    hash64 key = 0;
+
+    // Nodes that are not memoized run, and their outputs are hashed by content
+    if ( p_node->memoize == false )
+    {
+
+        // A node that is no longer memoized may still point into an entry
+        if ( p_node->p_memo_entry )
+        {
+            mutex_lock(&p_node_memo->_lock);
+            node_memo_pin(p_node, (void *) 0);
+            mutex_unlock(&p_node_memo->_lock);
+        }
+
+        // Run the node
+        if ( p_node->pfn_function )
+            if ( p_node->pfn_function(p_node) == 0 ) return 0;
+
+        // Hash each output that has a size
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+            p_node->out[j].hash = ( p_node->out[j].value && p_node->out[j].size ) ? node_memo_mix(hash_fnv64(p_node->out[j].value, p_node->out[j].size), p_node->out[j].size) : 0;
+
+        // Success
+        return 1;
+    }
+
+    // Key the node. If an input can not be hashed, the node just runs
+    if ( node_memo_key(p_node, &key) == 0 ) goto uncached;
+
+    // Look up the key
+    mutex_lock(&p_node_memo->_lock);
+    p_entry = node_memo_find(p_node_memo, key);
+
+    // Hit
+    if ( p_entry && p_entry->out_quantity == p_node->out_quantity )
+    {
+
+        // Keep the entry while the node points into it. The node's own outputs are kept aside
+        node_memo_pin(p_node, p_entry);
+        node_memo_touch(p_node_memo, p_entry);
+
+        // Serve each output from the entry. A typed output keeps its slot, and the value is copied into it
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+        {
+            if ( p_node->out[j].p_type && p_node->out[j].value && p_entry->_sizes[j] == p_node->out[j].p_type->size )
+                memcpy(p_node->out[j].value, node_memo_entry_output(p_entry, j), p_entry->_sizes[j]);
+            else
+                p_node->out[j].value = node_memo_entry_output(p_entry, j),
+                p_node->out[j].size  = p_entry->_sizes[j];
+            p_node->out[j].hash = node_memo_mix(key, j);
+        }
+
+        // Count
+        p_node_memo->hits++;
+        mutex_unlock(&p_node_memo->_lock);
+
+        // Success
+        return 1;
+    }
+
+    // Miss. The node's outputs are its own again before it runs, so it
+    // never writes into an entry
+    p_node_memo->misses++;
+    node_memo_pin(p_node, (void *) 0);
+    mutex_unlock(&p_node_memo->_lock);
+
+    // Run the node
+    if ( p_node->pfn_function )
+        if ( p_node->pfn_function(p_node) == 0 ) return 0;
+
+    // Store the outputs
+    {
+
+        // Initialized data
+        size_t _sizes[p_node->out_quantity + 1];
+        size_t total = 0;
+        int inserted = 0;
+
+        // Initialize memory
+        memset(_sizes, 0, sizeof(_sizes));
+
+        // Every output with a value needs a size
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+        {
+            if ( p_node->out[j].value && p_node->out[j].size == 0 ) goto unsized;
+            _sizes[j] = ( p_node->out[j].value ) ? p_node->out[j].size : 0;
+            total += _sizes[j];
+        }
+
+        // Entries larger than the memo are not kept
+        if ( total > p_node_memo->capacity ) goto unsized;
+
+        // Copy the outputs into an entry
+        if ( node_memo_entry_create(&p_entry, key, p_node->out_quantity, _sizes) == 0 ) goto unsized;
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+            if ( _sizes[j] ) memcpy(node_memo_entry_output(p_entry, j), p_node->out[j].value, _sizes[j]);
+
+        // Add the entry
+        mutex_lock(&p_node_memo->_lock);
+        inserted = node_memo_insert(p_node_memo, &p_entry);
+        mutex_unlock(&p_node_memo->_lock);
+
+        // Error check
+        if ( inserted == 0 ) goto failed_to_insert;
+    }
+
+    // Identify each output by the key
+    for (size_t j = 0; j < p_node->out_quantity; j++) p_node->out[j].hash = node_memo_mix(key, j);
+
+    // Success
+    return 1;
+
+    uncached:
+
+        // Count. The node's outputs are its own again before it runs
+        mutex_lock(&p_node_memo->_lock);
+        node_memo_pin(p_node, (void *) 0);
+        p_node_memo->misses++;
+        mutex_unlock(&p_node_memo->_lock);
+
+        // Run the node
+        if ( p_node->pfn_function )
+            if ( p_node->pfn_function(p_node) == 0 ) return 0;
+
+    unsized:
+
+        // Without a key or an entry, downstream nodes can not be keyed either
+        for (size_t j = 0; j < p_node->out_quantity; j++) p_node->out[j].hash = 0;
+
+        // Success
+        return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_memo:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"p_node_memo\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"p_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Memo errors
+        {
+            failed_to_insert:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Failed to add an entry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the entry, if the insert did not
+                if ( p_entry ) p_entry = NODE_REALLOC(p_entry, 0);
+
+                // Without an entry, downstream nodes can not be keyed
+                for (size_t j = 0; j < p_node->out_quantity; j++) p_node->out[j].hash = 0;
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_memo_save ( node_memo *const p_node_memo, const char *const p_path )
+{
+
+    // Argument check
+    if ( p_node_memo == (void *) 0 ) goto no_node_memo;
+    if ( p_path      == (void *) 0 ) goto no_path;
+
+    // Initialized data
+    FILE *p_f = fopen(p_path, "wb");
+    uint64_t _header[3] = { 0, NODE_MEMO_VERSION, 0 };
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
+
+    // Lock
+    mutex_lock(&p_node_memo->_lock);
+
+    // Write the header
+    memcpy(_header, NODE_MEMO_MAGIC, sizeof(NODE_MEMO_MAGIC));
+    _header[2] = p_node_memo->entry_quantity;
+    if ( fwrite(_header, sizeof(_header), 1, p_f) != 1 ) goto failed_to_write_file;
+
+    // Write each entry, least recently used first, so a load keeps the order
+    for (node_memo_entry *p_entry = p_node_memo->p_tail; p_entry; p_entry = p_entry->p_prev)
+    {
+
+        // Initialized data
+        uint64_t _record[2] = { p_entry->key, p_entry->out_quantity };
+
+        // Write the key and the output quantity
+        if ( fwrite(_record, sizeof(_record), 1, p_f) != 1 ) goto failed_to_write_file;
+
+        // Write the size of each output
+        for (size_t j = 0; j < p_entry->out_quantity; j++)
+        {
+            uint64_t size = p_entry->_sizes[j];
+            if ( fwrite(&size, sizeof(size), 1, p_f) != 1 ) goto failed_to_write_file;
+        }
+
+        // Write the bytes of each output
+        for (size_t j = 0; j < p_entry->out_quantity; j++)
+            if ( p_entry->_sizes[j] )
+                if ( fwrite(node_memo_entry_output(p_entry, j), p_entry->_sizes[j], 1, p_f) != 1 ) goto failed_to_write_file;
+    }
+
+    // Unlock
+    mutex_unlock(&p_node_memo->_lock);
+
+    // Close the file
+    if ( fclose(p_f) ) goto failed_to_close_file;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_memo:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"p_node_memo\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_write_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to write file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Unlock
+                mutex_unlock(&p_node_memo->_lock);
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+
+            failed_to_close_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to write file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_memo_load ( node_memo *const p_node_memo, const char *const p_path )
+{
+
+    // Argument check
+    if ( p_node_memo == (void *) 0 ) goto no_node_memo;
+    if ( p_path      == (void *) 0 ) goto no_path;
+
+    // Initialized data
+    FILE *p_f = fopen(p_path, "rb");
+    uint64_t _header[3] = { 0 };
+    node_memo_entry *p_entry = (void *) 0;
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open_file;
+
+    // Read the header
+    if ( fread(_header, sizeof(_header), 1, p_f) != 1 ) goto corrupt;
+
+    // Check the header
+    if ( memcmp(_header, NODE_MEMO_MAGIC, sizeof(NODE_MEMO_MAGIC)) ) goto corrupt;
+    if ( _header[1] != NODE_MEMO_VERSION ) goto corrupt;
+
+    // Read each entry
+    for (uint64_t i = 0; i < _header[2]; i++)
+    {
+
+        // Initialized data
+        uint64_t _record[2] = { 0 };
+        size_t *p_sizes = (void *) 0;
+        int result = 1;
+
+        // Read the key and the output quantity
+        if ( fread(_record, sizeof(_record), 1, p_f) != 1 ) goto corrupt;
+
+        // Error check
+        if ( _record[1] > 4096 ) goto corrupt;
+
+        // Read the size of each output
+        p_sizes = NODE_REALLOC(0, ( (size_t) _record[1] + 1 ) * sizeof(size_t));
+        if ( p_sizes == (void *) 0 ) goto no_mem;
+        for (size_t j = 0; result && j < _record[1]; j++)
+        {
+            uint64_t size = 0;
+            result = ( fread(&size, sizeof(size), 1, p_f) == 1 ) && ( size <= p_node_memo->capacity );
+            p_sizes[j] = (size_t) size;
+        }
+
+        // Allocate the entry
+        if ( result ) result = node_memo_entry_create(&p_entry, _record[0], (size_t) _record[1], p_sizes);
+        p_sizes = NODE_REALLOC(p_sizes, 0);
+
+        // Error check
+        if ( result == 0 ) goto corrupt;
+
+        // Read the bytes of each output
+        for (size_t j = 0; j < p_entry->out_quantity; j++)
+            if ( p_entry->_sizes[j] )
+                if ( fread(node_memo_entry_output(p_entry, j), p_entry->_sizes[j], 1, p_f) != 1 ) { p_entry = NODE_REALLOC(p_entry, 0); goto corrupt; }
+
+        // Add the entry
+        mutex_lock(&p_node_memo->_lock);
+        result = node_memo_insert(p_node_memo, &p_entry);
+        mutex_unlock(&p_node_memo->_lock);
+
+        // Error check
+        if ( result == 0 ) goto failed_to_insert;
+    }
+
+    // Close the file
+    fclose(p_f);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_memo:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"p_node_memo\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Memo errors
+        {
+            corrupt:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] File \"%s\" is not a memo, or is corrupt, in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+
+            failed_to_insert:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Failed to add an entry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open_file:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Close the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_memo_statistics ( node_memo *const p_node_memo, size_t *const p_hits, size_t *const p_misses, size_t *const p_evictions )
+{
+
+    // Argument check
+    if ( p_node_memo == (void *) 0 ) goto no_node_memo;
+
+    // Lock
+    mutex_lock(&p_node_memo->_lock);
+
+    // Return the counters to the caller
+    if ( p_hits      ) *p_hits      = p_node_memo->hits;
+    if ( p_misses    ) *p_misses    = p_node_memo->misses;
+    if ( p_evictions ) *p_evictions = p_node_memo->evictions;
+
+    // Unlock
+    mutex_unlock(&p_node_memo->_lock);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_memo:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"p_node_memo\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_memo_destroy ( node_memo **const pp_node_memo )
+{
+
+    // Argument check
+    if ( pp_node_memo == (void *) 0 ) goto no_node_memo;
+
+    // Initialized data
+    node_memo *p_node_memo = *pp_node_memo;
+
+    // Fast exit
+    if ( p_node_memo == (void *) 0 ) return 1;
+
+    // No more pointer for caller
+    *pp_node_memo = (void *) 0;
+
+    // Release each entry
+    for (node_memo_entry *p_entry = p_node_memo->p_head, *p_next = (void *) 0; p_entry; p_entry = p_next)
+        p_next = p_entry->p_next,
+        p_entry = NODE_REALLOC(p_entry, 0);
+
+    // Release the table
+    p_node_memo->pp_buckets = NODE_REALLOC(p_node_memo->pp_buckets, 0);
+
+    // Destroy the lock
+    mutex_destroy(&p_node_memo->_lock);
+
+    // Release the memo
+    p_node_memo = NODE_REALLOC(p_node_memo, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_memo:
+                #ifndef NDEBUG
+                    log_error("[node] [memo] Null pointer provided for parameter \"pp_node_memo\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -9,8 +9,132 @@
 // Header
 #include <node/node.h>
 
+// node module
+#include <node/memo.h>
+#include <node/trace.h>
+#include <node/plan.h>
+#include <node/export.h>
+#include <node/snapshot.h>
+
+// Enumeration definitions
+enum node_reload_change_e
+{
+    NODE_RELOAD_SAME    = 0,
+    NODE_RELOAD_UPDATE  = 1,
+    NODE_RELOAD_REPLACE = 2,
+    NODE_RELOAD_ADD     = 3
+};
+
+// Structure declarations
+struct node_build_connection_s;
+struct node_build_s;
+struct node_reload_connection_s;
+struct node_reload_s;
+
+// Type definitions
+typedef struct node_build_connection_s node_build_connection;
+typedef struct node_build_s node_build;
+typedef struct node_reload_connection_s node_reload_connection;
+typedef struct node_reload_s node_reload;
+
+// Structure definitions
+/** !
+ * A resolved connection, from output out_index of p_node_in to input
+ * in_index of p_node_out
+ */
+struct node_build_connection_s
+{
+    node *p_node_in;
+    node *p_node_out;
+    size_t out_index;
+    size_t in_index;
+};
+
+/** !
+ * The state shared by the shards that construct a graph. The names of
+ * node i are numbered from p_offsets[i]; first its own, then its inputs,
+ * then its outputs. Every occurrence of a name claims a slot of the 
+ * symbol table, and the earliest occurrence keeps it. Counts hold the
+ * quantity of symbols first seen in each shard, then the first id of 
+ * each shard.
+ */
+struct node_build_s
+{
+    node_graph *p_node_graph;
+    dict *p_nodes;
+    array *p_connection_list;
+
+    node_arena *p_arenas;
+    const char **pp_keys;
+    size_t *p_offsets;
+    size_t *p_counts;
+
+    node_symbol *p_occurrences;
+    size_t *p_ids;
+    bool *p_firsts;
+
+    node_build_connection *p_connections;
+};
+
+/** !
+ * A described connection, from output out_index of described node from
+ * to input in_index of described node to. The text names the input
+ */
+struct node_reload_connection_s
+{
+    size_t from;
+    size_t out_index;
+    size_t to;
+    size_t in_index;
+    const char *p_text;
+};
+
+/** !
+ * The state shared by the shards that diff a graph with a description.
+ * Described node i is named pp_names[i], described by pp_objects[i],
+ * and changes from pp_nodes[i], the node of the same name, or null
+ * pointer if there is none. Names finds described nodes by name, with
+ * the id of each name equal to its index. The inputs of described node
+ * i are numbered from p_starts[i]. Described marks the nodes of the 
+ * graph by index.
+ */
+struct node_reload_s
+{
+    node_graph *p_node_graph;
+    dict *p_nodes;
+    array *p_connection_list;
+
+    const char **pp_names;
+    const json_value **pp_objects;
+    node **pp_nodes;
+    enum node_reload_change_e *p_changes;
+    size_t *p_starts;
+    bool *p_described;
+    node_symbol_table names;
+
+    node_reload_connection *p_connections;
+};
+
 // Data
 static bool initialized = false;
+static dict *p_node_data_kinds = (void *) 0;
+static mutex node_data_kinds_lock;
+static dict *p_node_port_types = (void *) 0;
+static mutex node_port_types_lock;
+static node_port_type _node_port_types[] =
+{
+    { .p_name = "bool",   .size = sizeof(bool),       .alignment = _Alignof(bool)   },
+    { .p_name = "int",    .size = sizeof(int),        .alignment = _Alignof(int)    },
+    { .p_name = "uint",   .size = sizeof(unsigned),   .alignment = _Alignof(unsigned) },
+    { .p_name = "float",  .size = sizeof(float),      .alignment = _Alignof(float)  },
+    { .p_name = "double", .size = sizeof(double),     .alignment = _Alignof(double) },
+    { .p_name = "vec2",   .size = 2 * sizeof(float),  .alignment = 8  },
+    { .p_name = "vec3",   .size = 4 * sizeof(float),  .alignment = 16 },
+    { .p_name = "vec4",   .size = 4 * sizeof(float),  .alignment = 16 },
+    { .p_name = "mat2",   .size = 4 * sizeof(float),  .alignment = 16 },
+    { .p_name = "mat3",   .size = 12 * sizeof(float), .alignment = 16 },
+    { .p_name = "mat4",   .size = 16 * sizeof(float), .alignment = 16 }
+};
 
 // Function definitions
 void node_init ( void ) 
@@ -34,6 +158,18 @@ void node_init ( void )
     // Initialize the json library
     json_init();
 
+    // Construct the registry of node data kinds
+    dict_construct(&p_node_data_kinds, 64, 0);
+
+    // Construct a lock for the registry
+    mutex_create(&node_data_kinds_lock);
+
+    // Construct the registry of port types, with the builtin types
+    dict_construct(&p_node_port_types, 64, 0);
+    mutex_create(&node_port_types_lock);
+    for (size_t i = 0; i < sizeof(_node_port_types) / sizeof(*_node_port_types); i++)
+        dict_add(p_node_port_types, _node_port_types[i].p_name, &_node_port_types[i]);
+
     // Set the initialized flag
     initialized = true;
 
@@ -41,23 +177,43 @@ void node_init ( void )
     return; 
 }
 
-int node_create ( node **pp_node )
+int node_data_kind_register ( const char *const p_name, fn_node_data_constructor pfn_constructor, fn_node_data_destructor pfn_destructor )
 {
 
     // Argument check
-    if ( pp_node == (void *) 0 ) goto no_node;
+    if ( p_name          == (void *) 0 ) goto no_name;
+    if ( pfn_constructor == (void *) 0 ) goto no_constructor;
 
     // Initialized data
-    node *p_node = NODE_REALLOC(0, sizeof(node));
+    size_t len = strlen(p_name) + 1;
+    node_data_kind *p_kind = (void *) 0;
+
+    // Make sure the registry exists
+    if ( initialized == false ) node_init();
+
+    // Allocate the kind and its name in one block
+    p_kind = NODE_REALLOC(0, sizeof(node_data_kind) + len);
 
     // Error check
-    if ( p_node == (void *) 0 ) goto no_mem;
+    if ( p_kind == (void *) 0 ) goto no_mem;
 
-    // Initialize memory
-    memset(p_node, 0, sizeof(node));
+    // Populate the kind
+    memcpy((char *) (p_kind + 1), p_name, len);
+    p_kind->p_name          = (const char *) (p_kind + 1);
+    p_kind->pfn_constructor = pfn_constructor;
+    p_kind->pfn_destructor  = pfn_destructor;
 
-    // Return a pointer to the caller
-    *pp_node = p_node;
+    // Lock
+    mutex_lock(&node_data_kinds_lock);
+
+    // Error check
+    if ( dict_get(p_node_data_kinds, p_kind->p_name) ) goto duplicate_kind;
+
+    // Add the kind to the registry
+    dict_add(p_node_data_kinds, p_kind->p_name, p_kind);
+
+    // Unlock
+    mutex_unlock(&node_data_kinds_lock);
 
     // Success
     return 1;
@@ -67,11 +223,37 @@ int node_create ( node **pp_node )
 
         // Argument errors
         {
-            no_node:
+            no_name:
                 #ifndef NDEBUG
-                    log_error("[node] Null pointer provided for parameter \"pp_node\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[node] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
+
+                // Error
+                return 0;
+
+            no_constructor:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pfn_constructor\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            duplicate_kind:
+
+                // Unlock
+                mutex_unlock(&node_data_kinds_lock);
+
+                #ifndef NDEBUG
+                    log_error("[node] Node data kind \"%s\" is already registered in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Release the kind
+                p_kind = NODE_REALLOC(p_kind, 0);
+
                 // Error
                 return 0;
         }
@@ -82,30 +264,74 @@ int node_create ( node **pp_node )
                 #ifndef NDEBUG
                     log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
+
                 // Error
                 return 0;
         }
     }
 }
 
-int node_graph_create ( node_graph **pp_node_graph )
+const node_data_kind *node_data_kind_get ( const char *const p_name )
 {
 
     // Argument check
-    if ( pp_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_name            == (void *) 0 ) return (void *) 0;
+    if ( p_node_data_kinds == (void *) 0 ) return (void *) 0;
 
     // Initialized data
-    node_graph *p_node_graph = NODE_REALLOC(0, sizeof(node_graph));
+    const node_data_kind *p_kind = (void *) 0;
+
+    // Lock
+    mutex_lock(&node_data_kinds_lock);
+
+    // Find the kind
+    p_kind = dict_get(p_node_data_kinds, p_name);
+
+    // Unlock
+    mutex_unlock(&node_data_kinds_lock);
+
+    // Done
+    return p_kind;
+}
+
+int node_port_type_register ( const char *const p_name, size_t size, size_t alignment )
+{
+
+    // Argument check
+    if ( p_name == (void *) 0 ) goto no_name;
+    if ( size == 0 ) goto no_size;
+    if ( alignment == 0 || ( alignment & ( alignment - 1 ) ) || alignment > NODE_VALUE_ALIGNMENT ) goto wrong_alignment;
+
+    // Initialized data
+    size_t len = strlen(p_name) + 1;
+    node_port_type *p_type = (void *) 0;
+
+    // Make sure the registry exists
+    if ( initialized == false ) node_init();
+
+    // Allocate the type and its name in one block
+    p_type = NODE_REALLOC(0, sizeof(node_port_type) + len);
 
     // Error check
-    if ( p_node_graph == (void *) 0 ) goto no_mem;
+    if ( p_type == (void *) 0 ) goto no_mem;
 
-    // Initialize memory
-    memset(p_node_graph, 0, sizeof(node_graph));
+    // Populate the type
+    memcpy((char *) (p_type + 1), p_name, len);
+    p_type->p_name    = (const char *) (p_type + 1);
+    p_type->size      = size;
+    p_type->alignment = alignment;
 
-    // Return a pointer to the caller
-    *pp_node_graph = p_node_graph;
+    // Lock
+    mutex_lock(&node_port_types_lock);
+
+    // Error check
+    if ( dict_get(p_node_port_types, p_type->p_name) ) goto duplicate_type;
+
+    // Add the type to the registry
+    dict_add(p_node_port_types, p_type->p_name, p_type);
+
+    // Unlock
+    mutex_unlock(&node_port_types_lock);
 
     // Success
     return 1;
@@ -115,11 +341,45 @@ int node_graph_create ( node_graph **pp_node_graph )
 
         // Argument errors
         {
-            no_node_graph:
+            no_name:
                 #ifndef NDEBUG
-                    log_error("[node] Null pointer provided for parameter \"pp_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[node] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
+
+                // Error
+                return 0;
+
+            no_size:
+                #ifndef NDEBUG
+                    log_error("[node] Parameter \"size\" must be greater than 0 in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_alignment:
+                #ifndef NDEBUG
+                    log_error("[node] Parameter \"alignment\" must be a power of two no greater than %d in call to function \"%s\"\n", NODE_VALUE_ALIGNMENT, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            duplicate_type:
+
+                // Unlock
+                mutex_unlock(&node_port_types_lock);
+
+                #ifndef NDEBUG
+                    log_error("[node] Port type \"%s\" is already registered in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Release the type
+                p_type = NODE_REALLOC(p_type, 0);
+
                 // Error
                 return 0;
         }
@@ -130,276 +390,149 @@ int node_graph_create ( node_graph **pp_node_graph )
                 #ifndef NDEBUG
                     log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-                
+
                 // Error
                 return 0;
         }
     }
 }
 
-int node_graph_construct ( node_graph **pp_node_graph, const json_value *const p_value )
+const node_port_type *node_port_type_get ( const char *const p_name )
 {
 
     // Argument check
-    if ( pp_node_graph ==        (void *) 0 ) goto no_node_graph;
-    if ( p_value       ==        (void *) 0 ) goto no_value;
-    if ( p_value->type != JSON_VALUE_OBJECT ) goto wrong_type;
+    if ( p_name            == (void *) 0 ) return (void *) 0;
+    if ( p_node_port_types == (void *) 0 ) return (void *) 0;
 
     // Initialized data
-    node_graph *p_node_graph = (void *) 0;
+    const node_port_type *p_type = (void *) 0;
 
-    // Allocate a node graph
-    if ( node_graph_create(&p_node_graph) == 0 ) goto failed_to_allocate_node_graph;
+    // Lock
+    mutex_lock(&node_port_types_lock);
 
-    // Parse the json object into a node graph
-    {
+    // Find the type
+    p_type = dict_get(p_node_port_types, p_name);
 
-        // Initialized data
-        dict *p_dict = p_value->object;
-        json_value *p_nodes       = dict_get(p_dict, "nodes"),
-                   *p_connections = dict_get(p_dict, "connections");
+    // Unlock
+    mutex_unlock(&node_port_types_lock);
 
-        // Missing properties
-        if ( p_nodes == (void *) 0 ) goto missing_nodes_value;
+    // Done
+    return p_type;
+}
 
-        // Type check
-        if ( p_nodes->type != JSON_VALUE_OBJECT ) goto wrong_nodes_type;
+bool node_port_split ( const json_value *const p_value, const char **const pp_name, const char **const pp_type )
+{
 
-        // Parse the nodes
-        {
+    // An untyped port is its name
+    if ( p_value->type == JSON_VALUE_STRING ) return *pp_name = p_value->string, *pp_type = (void *) 0, true;
 
-            // Initialized data
-            dict *p_dict = p_nodes->object;
-            size_t node_quantity = dict_keys(p_dict, 0);
-            const char **pp_keys = (void *) 0; 
+    // A typed port is an object with one property, from its name to its type
+    if ( p_value->type != JSON_VALUE_OBJECT || dict_keys(p_value->object, 0) != 1 ) return false;
 
-            // Error check
-            if ( node_quantity == (void *) 0 ) goto no_nodes;
+    // Initialized data
+    const char *p_key = (void *) 0;
+    const json_value *p_type = (void *) 0;
 
-            // Grow the allocation
-            p_node_graph = NODE_REALLOC(p_node_graph, sizeof(node_graph) + (node_quantity * sizeof(node *)));
+    // Get the property
+    dict_keys(p_value->object, &p_key);
+    p_type = dict_get(p_value->object, p_key);
 
-            // Store the node quantity
-            p_node_graph->node_quantity = node_quantity;
+    // Type check
+    if ( p_type == (void *) 0 || p_type->type != JSON_VALUE_STRING ) return false;
 
-            // Allocate memory for keys
-            pp_keys = NODE_REALLOC(0, node_quantity * sizeof(node *));
+    // Return the name and type to the caller
+    *pp_name = p_key,
+    *pp_type = p_type->string;
 
-            // Construct a lookup for nodes
-            if ( dict_construct(&p_node_graph->p_nodes, node_quantity, 0) == 0 ) goto failed_to_construct_dict;
+    // Done
+    return true;
+}
 
-            // Get the keys
-            if ( dict_keys(p_dict, pp_keys) == 0 ) goto failed_to_get_keys;
+int node_arena_allocate ( node_arena *const p_arena, size_t size, void **const pp_result )
+{
 
-            // Construct each node
-            for (size_t i = 0; i < node_quantity; i++)
-            {
-                
-                // Initialized data
-                node *p_node = (void *) 0;
-                const char *const p_key = pp_keys[i];
-                json_value *p_node_value = dict_get(p_dict, p_key);
+    // Argument check
+    if ( p_arena   == (void *) 0 ) goto no_arena;
+    if ( pp_result == (void *) 0 ) goto no_result;
 
-                // Construct the node
-                if ( node_construct(&p_node, p_key, p_node_value, 0) == 0 ) goto failed_to_construct_node;
+    // Initialized data
+    node_arena_block *p_block = p_arena->p_head;
 
-                // Store the node in the node graph
-                p_node_graph->_p_nodes[i] = p_node;
+    // Round the size up to keep every allocation aligned
+    size = ( size + _Alignof(max_align_t) - 1 ) & ~( _Alignof(max_align_t) - 1 );
 
-                // Add the node to the dictionary
-                dict_add(p_node_graph->p_nodes, p_node->_name, p_node);
-            }
-            
-            // Release memory
-            pp_keys = NODE_REALLOC(pp_keys, 0);
-        }
-        
-        // Parse the connections
-        {
-            
-            // Initialized data
-            array *p_array = p_connections->list;
-            size_t connection_quantity = array_size(p_array);
+    // Add a block if the current one is full
+    if ( p_block == (void *) 0 || p_block->size - p_block->used < size )
+    {
 
-            // Construct each connection
-            for (size_t i = 0; i < connection_quantity; i++)
-            {
-                
-                // Initialized data
-                json_value *p_connection = (void *) 0;
-                
-                // Store the connection
-                array_index(p_array, i, (void **)&p_connection);
+        // Initialized data
+        size_t block_size = ( p_arena->block_size ) ? p_arena->block_size : NODE_ARENA_BLOCK_SIZE;
+        bool   dedicated  = ( size > block_size );
 
-                // Error check
-                if ( p_connection->type != JSON_VALUE_ARRAY ) goto wrong_connection_type;
+        // Oversized requests get a block of their own
+        if ( dedicated ) block_size = size;
 
-                // Parse the connection
-                {
+        // Allocate the block
+        p_block = NODE_REALLOC(0, sizeof(node_arena_block) + block_size);
 
-                    // Initialized data
-                    array *p_array = p_connection->list;
-                    json_value *p_in  = (void *) 0,
-                               *p_out = (void *) 0;
-
-                    // Error check
-                    if ( array_size(p_array) > 2 ) goto too_many_connections;
-                    if ( array_size(p_array) < 2 ) goto too_few_connections;
-
-                    // Get the input and output
-                    array_index(p_array, 0, (void **) &p_in);
-                    array_index(p_array, 1, (void **) &p_out);
-
-                    // Error check
-                    if ( p_in        == 0 ) goto no_input;
-                    if ( p_out       == 0 ) goto no_output;
-
-                    // Type check
-                    if ( p_in->type  != JSON_VALUE_STRING ) goto input_wrong_type;
-                    if ( p_out->type != JSON_VALUE_STRING ) goto output_wrong_type;
-                    
-                    // Parse the input and output
-                    {
-                        
-                        // Initialized data
-                        node *p_node_in  = (void *) 0,
-                             *p_node_out = (void *) 0;
-                        char *in_node_text = p_in->string,
-                             *in_connection_text = (void *) 0,
-                             *out_node_text = p_out->string,
-                             *out_connection_text = (void *) 0;
-                        size_t j = 0, k = 0;
-
-                        // Extract the input connection
-                        in_connection_text = strchr(in_node_text, ':');
-
-                        // Extract the output connection
-                        out_connection_text = strchr(out_node_text, ':');
-
-                        // Error check
-                        if ( in_connection_text  == (void *) 0 ) goto input_malformed;
-                        if ( out_connection_text == (void *) 0 ) goto output_malformed;
-
-                        // Split the string
-                        *in_connection_text = '\0', *out_connection_text = '\0';
-
-                        // Increment the cursor
-                        in_connection_text++, out_connection_text++;
-
-                        // Store the node
-                        p_node_in  = dict_get(p_node_graph->p_nodes, in_node_text);
-                        p_node_out = dict_get(p_node_graph->p_nodes, out_node_text);
-
-                        // Make the connection from the input
-                        {
-
-                            // Iterate through each output in the input node
-                            for (j = 0; j < p_node_in->out_quantity; j++)
-
-                                // Find the corresponding connection
-                                if ( strcmp(p_node_in->out[j]._name, in_connection_text) == 0 ) break;
-                            
-                            // Store the output node
-                            p_node_in->out[j].p_out = p_node_out;
-
-                            // Iterate through each input in the output node
-                            for (k = 0; k < p_node_out->in_quantity; k++)
-
-                                // Find the corresponding connection
-                                if ( strcmp(p_node_out->in[k]._name, out_connection_text) == 0 ) break;
-                            
-                            // Store the index of the input connection
-                            p_node_in->out[j].in_index = k;
-                        }
-
-                        // Make the connection to the output
-                        {
-
-                            // Iterate through each input in the output node
-                            for (j = 0; j < p_node_out->in_quantity; j++)
-
-                                // Find the corresponding connection
-                                if ( strcmp(p_node_out->in[j]._name, out_connection_text) == 0 ) break;
-                            
-                            // Store the output node
-                            p_node_out->in[j].p_in = p_node_in;
-
-                            // Iterate through each output in the input node
-                            for (k = 0; k < p_node_in->out_quantity; k++)
-
-                                // Find the corresponding connection
-                                if ( strcmp(p_node_in->out[k]._name, in_connection_text) == 0 ) break;
-                            
-                            // Store the index of the output connection
-                            p_node_out->in[j].out_index = k;
-                        }
-                    }
-                }
-            }
+        // Error check
+        if ( p_block == (void *) 0 ) goto no_mem;
+
+        // Populate the block
+        p_block->size = block_size,
+        p_block->used = 0;
+
+        // Keep allocating from the current block after a dedicated one
+        if ( dedicated && p_arena->p_head )
+            p_block->p_next = p_arena->p_head->p_next,
+            p_arena->p_head->p_next = p_block;
+
+        // Otherwise, the new block becomes the current block, and the next one doubles
+        else
+        {
+            p_block->p_next = p_arena->p_head,
+            p_arena->p_head = p_block;
+
+            if ( dedicated == false && block_size < ( (size_t) NODE_ARENA_BLOCK_SIZE << 10 ) ) p_arena->block_size = block_size * 2;
         }
     }
 
     // Return a pointer to the caller
-    *pp_node_graph = p_node_graph;
+    *pp_result = (unsigned char *) p_block->_data + p_block->used;
+
+    // Bump
+    p_block->used += size;
 
     // Success
     return 1;
 
-    no_nodes:
-    failed_to_construct_dict:
-    failed_to_get_keys:
-    missing_nodes_value:
-    failed_to_construct_node:
-    wrong_nodes_type:
-    no_connections:
-    wrong_connection_type:
-    too_many_connections:
-    too_few_connections:
-    no_input:
-    no_output:
-    input_wrong_type:
-    output_wrong_type:
-    input_malformed:
-    output_malformed:
-
-        // Error
-        return 0;
-
     // Error handling
     {
-        
+
         // Argument errors
         {
-            no_node_graph:
-                #ifndef NDEBUG
-                    log_error("[node] Null pointer provided for parameter \"pp_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
-                #endif
-                
-                // Error
-                return 0;
-
-            no_value:
+            no_arena:
                 #ifndef NDEBUG
-                    log_error("[node] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[node] Null pointer provided for parameter \"p_arena\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
                 
                 // Error
                 return 0;
 
-            wrong_type:
+            no_result:
                 #ifndef NDEBUG
-                    log_error("[node] Parameter \"p_value\" must be of type [ object ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[node] Null pointer provided for parameter \"pp_result\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
                 
                 // Error
                 return 0;
         }
- 
-        // Node errors
+
+        // Standard library errors
         {
-            failed_to_allocate_node_graph:
+            no_mem:
                 #ifndef NDEBUG
-                    log_error("[node] Failed to allocate node graph in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
                 #endif
                 
                 // Error
@@ -408,85 +541,73 @@ int node_graph_construct ( node_graph **pp_node_graph, const json_value *const p
     }
 }
 
-int node_construct ( node **pp_node, const char *const p_name, const json_value *const p_value, fn_node_data_constructor *pfn_node_data_constructor )
+void node_arena_release ( node_arena *const p_arena )
 {
 
-    // Argument check
-    if ( pp_node       ==        (void *) 0 ) goto no_node;
-    if ( p_name        ==        (void *) 0 ) goto no_name;
-    if ( p_value       ==        (void *) 0 ) goto no_value;
-    if ( p_value->type != JSON_VALUE_OBJECT ) goto wrong_type;
-
-    // Initialized data
-    node *p_node = (void *) 0;
+    // Release each block
+    for (node_arena_block *p_block = p_arena->p_head, *p_next = (void *) 0; p_block; p_block = p_next)
+        p_next = p_block->p_next,
+        p_block = NODE_REALLOC(p_block, 0);
 
-    // Allocate a node
-    if ( node_create(&p_node) == 0 ) goto failed_to_create_node;
+    // Empty the arena
+    *p_arena = (node_arena) { 0 };
 
-    // Construct a node from a json value
-    {
+    // Done
+    return;
+}
 
-        // Initialized data
-        dict *p_dict = p_value->object;
-        json_value *p_out  = dict_get(p_dict, "out"),
-                   *p_in   = dict_get(p_dict, "in"),
-                   *p_data = dict_get(p_dict, "data");
-        
-        // Set the name
-        {
-            size_t len = strlen(p_name);
+void node_arena_merge ( node_arena *const p_arena, node_arena *const p_other )
+{
 
-            // Copy the string
-            strncpy(p_node->_name, p_name, len);
-        }
+    // Initialized data
+    node_arena_block *p_tail = p_other->p_head;
 
-        // Set the out
-        if ( p_out ) 
-        {
+    // Nothing to move
+    if ( p_tail == (void *) 0 ) return;
 
-            // Initialized data
-            array *p_array = p_out->list;
-            size_t len = array_size(p_array);
+    // Find the last block of the source
+    while ( p_tail->p_next ) p_tail = p_tail->p_next;
 
-            p_node->out_quantity = len;
+    // The blocks of the source follow the current block of the destination
+    if ( p_arena->p_head )
+        p_tail->p_next = p_arena->p_head->p_next,
+        p_arena->p_head->p_next = p_other->p_head;
 
-            for (size_t i = 0; i < len; i++)
-            {
-                
-                // Initialized data
-                json_value *i_value = (void *) 0;
+    // Or, the source becomes the destination
+    else *p_arena = *p_other;
 
-                array_index(p_array, i, (void **)&i_value);
+    // Empty the source
+    *p_other = (node_arena) { 0 };
 
-                strncpy(p_node->out[i]._name, i_value->string, 63);
-            }
-        }
+    // Done
+    return;
+}
 
-        // Set the in
-        if ( p_in ) 
-        {
+int node_create ( node **pp_node, node_arena *p_arena, size_t in_quantity, size_t out_quantity, size_t text_size )
+{
 
-            // Initialized data
-            array *p_array = p_in->list;
-            size_t len = array_size(p_array);
+    // Argument check
+    if ( pp_node == (void *) 0 ) goto no_node;
 
-            p_node->in_quantity = len;
+    // Initialized data
+    size_t size = sizeof(node) + ( in_quantity * sizeof(node_input) ) + ( out_quantity * sizeof(node_output) ) + text_size;
+    node *p_node = (void *) 0;
 
-            for (size_t i = 0; i < len; i++)
-            {
-                
-                // Initialized data
-                json_value *i_value = (void *) 0;
+    // Allocate from the arena, if there is one
+    if ( p_arena ) node_arena_allocate(p_arena, size, (void **) &p_node);
+    else           p_node = NODE_REALLOC(0, size);
 
-                array_index(p_array, i, (void **)&i_value);
+    // Error check
+    if ( p_node == (void *) 0 ) goto no_mem;
 
-                strncpy(p_node->in[i]._name, i_value->string, 63);
-            }
-        }
+    // Initialize memory
+    memset(p_node, 0, size);
 
-        // Store the node data
-        p_node->value = p_data;
-    }
+    // Carve the ports out of the allocation
+    p_node->in_quantity  = in_quantity;
+    p_node->out_quantity = out_quantity;
+    p_node->in           = (node_input *) (p_node + 1);
+    p_node->out          = (node_output *) (p_node->in + in_quantity);
 
     // Return a pointer to the caller
     *pp_node = p_node;
@@ -497,21 +618,5003 @@ int node_construct ( node **pp_node, const char *const p_name, const json_value
     // Error handling
     {
 
-        // Argument check
+        // Argument errors
         {
             no_node:
                 #ifndef NDEBUG
                     log_error("[node] Null pointer provided for parameter \"pp_node\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
-
+                
                 // Error
                 return 0;
+        }
 
-            no_name:
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_create ( node_graph **pp_node_graph, size_t node_quantity )
+{
+
+    // Argument check
+    if ( pp_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Initialized data
+    node_graph *p_node_graph = NODE_REALLOC(0, sizeof(node_graph));
+
+    // Error check
+    if ( p_node_graph == (void *) 0 ) goto no_mem;
+
+    // Initialize memory
+    memset(p_node_graph, 0, sizeof(node_graph));
+
+    // Allocate the node pointers
+    p_node_graph->_p_nodes = NODE_REALLOC(0, ( node_quantity ? node_quantity : 1 ) * sizeof(node *));
+
+    // Error check
+    if ( p_node_graph->_p_nodes == (void *) 0 ) { p_node_graph = NODE_REALLOC(p_node_graph, 0); goto no_mem; }
+
+    // Initialize memory
+    memset(p_node_graph->_p_nodes, 0, ( node_quantity ? node_quantity : 1 ) * sizeof(node *));
+
+    // Store the node quantity
+    p_node_graph->node_quantity = node_quantity,
+    p_node_graph->node_capacity = ( node_quantity ) ? node_quantity : 1;
+
+    // Return a pointer to the caller
+    *pp_node_graph = p_node_graph;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pp_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_symbol_table_construct ( node_symbol_table *const p_symbol_table, size_t capacity )
+{
+
+    // Argument check
+    if ( p_symbol_table == (void *) 0 ) goto no_symbol_table;
+
+    // Initialized data
+    size_t slot_quantity = 16;
+
+    // Round up to a power of two at twice the expected symbol quantity
+    while ( slot_quantity < 2 * capacity ) slot_quantity <<= 1;
+
+    // Populate the symbol table
+    *p_symbol_table = (node_symbol_table)
+    {
+        .quantity  = 0,
+        .capacity  = slot_quantity / 2,
+        .p_symbols = NODE_REALLOC(0, ( slot_quantity / 2 ) * sizeof(node_symbol)),
+        .p_slots   = NODE_REALLOC(0, slot_quantity * sizeof(size_t))
+    };
+
+    // Error check
+    if ( p_symbol_table->p_symbols == (void *) 0 ) goto no_mem;
+    if ( p_symbol_table->p_slots   == (void *) 0 ) goto no_mem;
+
+    // Every slot starts out empty
+    memset(p_symbol_table->p_slots, 0, slot_quantity * sizeof(size_t));
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_symbol_table:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_symbol_table\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_symbol_table_find ( const node_symbol_table *const p_symbol_table, const char *const p_text, size_t length, hash64 hash, size_t *const p_id )
+{
+
+    // State check
+    if ( p_symbol_table->p_slots == (void *) 0 ) return 0;
+
+    // Initialized data
+    size_t mask = ( p_symbol_table->capacity * 2 ) - 1;
+
+    // Probe until the symbol or an empty slot is found
+    for (size_t i = hash & mask; p_symbol_table->p_slots[i]; i = ( i + 1 ) & mask)
+    {
+
+        // Initialized data
+        const node_symbol *p_symbol = &p_symbol_table->p_symbols[p_symbol_table->p_slots[i] - 1];
+
+        // Compare the hash, then the length, then the text
+        if ( p_symbol->hash   != hash   ) continue;
+        if ( p_symbol->length != length ) continue;
+        if ( memcmp(p_symbol->p_text, p_text, length) ) continue;
+
+        // Return the id to the caller
+        *p_id = p_symbol_table->p_slots[i] - 1;
+
+        // Found
+        return 1;
+    }
+
+    // Not found
+    return 0;
+}
+
+int node_symbol_table_grow ( node_symbol_table *const p_symbol_table )
+{
+
+    // Initialized data
+    size_t capacity = p_symbol_table->capacity * 2,
+           mask = ( capacity * 2 ) - 1;
+    node_symbol *p_symbols = (void *) 0;
+    size_t *p_slots = NODE_REALLOC(0, capacity * 2 * sizeof(size_t));
+
+    // Error check
+    if ( p_slots == (void *) 0 ) goto no_mem;
+
+    // Grow the symbols
+    p_symbols = NODE_REALLOC(p_symbol_table->p_symbols, capacity * sizeof(node_symbol));
+
+    // Error check
+    if ( p_symbols == (void *) 0 ) goto no_mem;
+
+    // The old block may be gone, so the table takes the new one now
+    p_symbol_table->p_symbols = p_symbols;
+
+    // Every slot starts out empty
+    memset(p_slots, 0, capacity * 2 * sizeof(size_t));
+
+    // Reinsert each id
+    for (size_t id = 0; id < p_symbol_table->quantity; id++)
+    {
+
+        // Initialized data
+        size_t i = p_symbols[id].hash & mask;
+
+        // Linear probe
+        while ( p_slots[i] ) i = ( i + 1 ) & mask;
+
+        // Store the id
+        p_slots[i] = id + 1;
+    }
+
+    // Release the old slots
+    p_symbol_table->p_slots = NODE_REALLOC(p_symbol_table->p_slots, 0);
+
+    // Update the symbol table
+    p_symbol_table->capacity = capacity,
+    p_symbol_table->p_slots  = p_slots;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the new slots
+                if ( p_slots ) p_slots = NODE_REALLOC(p_slots, 0);
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_symbol_table_intern ( node_symbol_table *const p_symbol_table, const char *const p_text, size_t length, size_t *const p_id )
+{
+
+    // Initialized data
+    hash64 hash = hash_fnv64(p_text, length);
+    size_t mask = 0, i = 0;
+
+    // Already interned
+    if ( node_symbol_table_find(p_symbol_table, p_text, length, hash, p_id) ) return 1;
+
+    // Keep the load factor at or under one half
+    if ( p_symbol_table->quantity == p_symbol_table->capacity )
+        if ( node_symbol_table_grow(p_symbol_table) == 0 ) goto failed_to_grow;
+
+    // Find an empty slot
+    for (mask = ( p_symbol_table->capacity * 2 ) - 1, i = hash & mask; p_symbol_table->p_slots[i]; i = ( i + 1 ) & mask);
+
+    // Store the symbol. The text is owned by whoever provided it
+    p_symbol_table->p_symbols[p_symbol_table->quantity] = (node_symbol)
+    {
+        .hash   = hash,
+        .p_text = p_text,
+        .length = length,
+        .p_node = (void *) 0
+    };
+
+    // Store the id
+    p_symbol_table->p_slots[i] = ++p_symbol_table->quantity;
+
+    // Return the id to the caller
+    *p_id = p_symbol_table->quantity - 1;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Symbol errors
+        {
+            failed_to_grow:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to grow symbol table in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_symbol_table_truncate ( node_symbol_table *const p_symbol_table, size_t quantity )
+{
+
+    // Initialized data
+    size_t mask = ( p_symbol_table->capacity * 2 ) - 1;
+
+    // Clear the slot of each later id, newest first. Nothing interned
+    // before an id probed past its slot, so each probe chain stays whole
+    while ( p_symbol_table->quantity > quantity )
+    {
+
+        // Initialized data
+        size_t id = --p_symbol_table->quantity,
+               i  = p_symbol_table->p_symbols[id].hash & mask;
+
+        // Find the slot of the id
+        while ( p_symbol_table->p_slots[i] != id + 1 ) i = ( i + 1 ) & mask;
+
+        // Clear it
+        p_symbol_table->p_slots[i] = 0;
+    }
+}
+
+int node_graph_port_resolve ( const node_graph *const p_node_graph, const char *const p_text, bool input, node **const pp_node, size_t *const p_index )
+{
+
+    // Initialized data
+    const char *p_port_text = strchr(p_text, ':');
+    const node_symbol_table *p_symbol_table = &p_node_graph->symbols;
+    size_t node_length = 0,
+           port_length = 0,
+           node_id     = 0,
+           port_id     = 0;
+    node *p_node = (void *) 0;
+
+    // Error check
+    if ( p_port_text == (void *) 0 ) goto malformed;
+
+    // Compute the length of each part
+    node_length = (size_t) ( p_port_text - p_text ),
+    port_length = strlen(++p_port_text);
+
+    // Find the node
+    if ( node_symbol_table_find(p_symbol_table, p_text, node_length, hash_fnv64(p_text, node_length), &node_id) == 0 ) goto unknown_node;
+
+    // Store the node
+    p_node = p_symbol_table->p_symbols[node_id].p_node;
+
+    // Error check
+    if ( p_node == (void *) 0 ) goto unknown_node;
+
+    // Find the port
+    if ( node_symbol_table_find(p_symbol_table, p_port_text, port_length, hash_fnv64(p_port_text, port_length), &port_id) == 0 ) goto unknown_port;
+
+    // Search the ports by id
+    if ( input )
+    {
+        for (size_t i = 0; i < p_node->in_quantity; i++)
+            if ( p_node->in[i].id == port_id ) { *p_index = i; goto done; }
+    }
+    else
+    {
+        for (size_t i = 0; i < p_node->out_quantity; i++)
+            if ( p_node->out[i].id == port_id ) { *p_index = i; goto done; }
+    }
+    
+    // The node has no such port
+    goto unknown_port;
+
+    done:
+
+    // Return a pointer to the caller
+    *pp_node = p_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Connection errors
+        {
+            malformed:
+                #ifndef NDEBUG
+                    log_error("[node] Connection \"%s\" must be of the form \"node:port\" in call to function \"%s\"\n", p_text, __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+
+            unknown_node:
+                #ifndef NDEBUG
+                    log_error("[node] Connection \"%s\" refers to an unknown node in call to function \"%s\"\n", p_text, __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+
+            unknown_port:
+                #ifndef NDEBUG
+                    log_error("[node] Connection \"%s\" refers to an unknown %s port in call to function \"%s\"\n", p_text, ( input ) ? "input" : "output", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t node_shard_quantity ( size_t quantity, size_t minimum, size_t thread_quantity )
+{
+
+    // Initialized data
+    size_t shard_quantity = 0;
+
+    // Default to one thread per online processor
+    if ( thread_quantity == 0 )
+    {
+
+        // Initialized data
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+        // Store the thread quantity
+        thread_quantity = ( processors > 0 ) ? (size_t) processors : 1;
+    }
+
+    // Give each shard at least the minimum
+    if ( minimum == 0 ) minimum = 1;
+    shard_quantity = ( quantity + minimum - 1 ) / minimum;
+
+    // Done
+    return ( shard_quantity > thread_quantity ) ? thread_quantity : shard_quantity;
+}
+
+void *node_shard_main ( void *p_parameter )
+{
+
+    // Initialized data
+    node_shard *p_shard = p_parameter;
+
+    // Do the work, and fail every shard if it fails
+    if ( p_shard->pfn_shard(p_shard) == 0 ) atomic_store(p_shard->p_failed, true);
+
+    // Done
+    return (void *) 0;
+}
+
+int node_shards_run ( size_t quantity, size_t minimum, size_t thread_quantity, fn_node_shard pfn_shard, void *p_context )
+{
+
+    // Argument check
+    if ( pfn_shard == (void *) 0 ) goto no_shard_function;
+
+    // Initialized data
+    node_shard *p_shards = (void *) 0;
+    atomic_bool failed = false;
+    size_t shard_quantity = node_shard_quantity(quantity, minimum, thread_quantity),
+           started        = 0;
+
+    // Nothing to do
+    if ( shard_quantity == 0 ) return 1;
+
+    // Allocate the shards
+    p_shards = NODE_REALLOC(0, shard_quantity * sizeof(node_shard));
+
+    // Error check
+    if ( p_shards == (void *) 0 ) goto no_mem;
+
+    // Split the work into contiguous ranges
+    for (size_t i = 0; i < shard_quantity; i++)
+        p_shards[i] = (node_shard)
+        {
+            .p_context = p_context,
+            .index     = i,
+            .begin     = quantity * i / shard_quantity,
+            .end       = quantity * ( i + 1 ) / shard_quantity,
+            .pfn_shard = pfn_shard,
+            .p_failed  = &failed
+        };
+
+    // Start a thread for every shard but the first
+    for (started = 1; started < shard_quantity; started++)
+        if ( pthread_create(&p_shards[started].thread, 0, node_shard_main, &p_shards[started]) ) break;
+
+    // Run the first shard on this thread
+    node_shard_main(&p_shards[0]);
+
+    // Run the shards that did not get a thread on this thread
+    for (size_t i = started; i < shard_quantity; i++)
+        node_shard_main(&p_shards[i]);
+
+    // Wait for the other threads
+    for (size_t i = 1; i < started; i++)
+        pthread_join(p_shards[i].thread, 0);
+
+    // Release the shards
+    p_shards = NODE_REALLOC(p_shards, 0);
+
+    // Success, unless a shard failed
+    return ( atomic_load(&failed) == false );
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_shard_function:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pfn_shard\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_data_construct_shard ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_graph *p_node_graph = p_shard->p_context;
+    size_t i = 0;
+
+    // Construct the data of each node in the shard
+    for (i = p_shard->begin; i < p_shard->end; i++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[i];
+
+        // Stop early if another shard failed
+        if ( atomic_load_explicit(p_shard->p_failed, memory_order_relaxed) ) return 1;
+
+        // Skip nodes without a kind, and nodes that already have data
+        if ( p_node->p_kind == (void *) 0 || p_node->p_data ) continue;
+
+        // Construct the node data
+        if ( p_node->p_kind->pfn_constructor(p_node->value, &p_node->p_data) == 0 ) goto failed_to_construct_data;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Node errors
+        {
+            failed_to_construct_data:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to construct data of node \"%s\" of kind \"%s\" in call to function \"%s\"\n", p_node_graph->_p_nodes[i]->p_name, p_node_graph->_p_nodes[i]->p_kind->p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_data_construct ( node_graph *const p_node_graph, size_t thread_quantity )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Construct the data of each shard of nodes
+    if ( node_shards_run(p_node_graph->node_quantity, NODE_DATA_SHARD_SIZE, thread_quantity, node_data_construct_shard, p_node_graph) == 0 ) goto failed_to_construct_data;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_construct_data:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_values_allocate ( node_graph *const p_node_graph, size_t begin )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Initialized data
+    size_t size = 0;
+    unsigned char *p_values = (void *) 0;
+
+    // Lay out the slots
+    for (size_t v = begin; v < p_node_graph->node_quantity; v++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[v];
+
+        // Each typed output without a value
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+            if ( p_node->out[j].p_type && p_node->out[j].value == (void *) 0 )
+                size = ( ( size + p_node->out[j].p_type->alignment - 1 ) & ~( p_node->out[j].p_type->alignment - 1 ) ) + p_node->out[j].p_type->size;
+    }
+
+    // Fast exit
+    if ( size == 0 ) return 1;
+
+    // Allocate the block, with room to align it
+    if ( node_arena_allocate(&p_node_graph->values, size + NODE_VALUE_ALIGNMENT - 1, (void **) &p_values) == 0 ) goto no_mem;
+
+    // Align the block, and zero it
+    p_values = (unsigned char *) ( ( (uintptr_t) p_values + NODE_VALUE_ALIGNMENT - 1 ) & ~ (uintptr_t) ( NODE_VALUE_ALIGNMENT - 1 ) );
+    memset(p_values, 0, size);
+
+    // Point each output at its slot
+    size = 0;
+    for (size_t v = begin; v < p_node_graph->node_quantity; v++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        // Each typed output without a value
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+        {
+
+            // Skip untyped outputs, and outputs with a value
+            if ( p_node->out[j].p_type == (void *) 0 || p_node->out[j].value ) continue;
+
+            // Place the slot
+            size = ( size + p_node->out[j].p_type->alignment - 1 ) & ~( p_node->out[j].p_type->alignment - 1 );
+            p_node->out[j].value = p_values + size;
+            size += p_node->out[j].p_type->size;
+        }
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+const char *node_build_name ( const node *const p_node, size_t q )
+{
+
+    // The name of the node comes first, then its inputs, then its outputs
+    if ( q == 0 ) return p_node->p_name;
+    if ( q <= p_node->in_quantity ) return p_node->in[q - 1].p_name;
+
+    // Done
+    return p_node->out[q - 1 - p_node->in_quantity].p_name;
+}
+
+size_t node_build_probe ( const node_build *const p_build, size_t o )
+{
+
+    // Initialized data
+    const node_symbol_table *p_symbol_table = &p_build->p_node_graph->symbols;
+    const node_symbol *p_symbol = &p_build->p_occurrences[o];
+    size_t mask = ( p_symbol_table->capacity * 2 ) - 1,
+           i    = p_symbol->hash & mask;
+
+    // Probe until a slot claimed by the same text is found
+    for (;; i = ( i + 1 ) & mask)
+    {
+
+        // Initialized data
+        atomic_size_t *p_slot = (atomic_size_t *) &p_symbol_table->p_slots[i];
+        size_t claim = atomic_load(p_slot);
+
+        // Claim an empty slot, or take a slot from a later occurrence of the same text
+        while ( true )
+        {
+
+            // Initialized data
+            const node_symbol *p_other = (void *) 0;
+
+            // Empty
+            if ( claim == 0 )
+            {
+                if ( atomic_compare_exchange_weak(p_slot, &claim, o + 1) ) return i;
+                continue;
+            }
+
+            // Store the claimed occurrence
+            p_other = &p_build->p_occurrences[claim - 1];
+
+            // Another symbol
+            if ( p_other->hash != p_symbol->hash || p_other->length != p_symbol->length || memcmp(p_other->p_text, p_symbol->p_text, p_symbol->length) ) break;
+
+            // The same symbol, first seen earlier
+            if ( claim - 1 <= o ) return i;
+
+            // The same symbol, first seen later
+            if ( atomic_compare_exchange_weak(p_slot, &claim, o + 1) ) return i;
+        }
+    }
+}
+
+int node_build_nodes ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+    node_graph *p_node_graph = p_build->p_node_graph;
+    size_t i = p_shard->begin;
+
+    // Construct each node
+    for (; i < p_shard->end; i++)
+    {
+
+        // Initialized data
+        node *p_node = (void *) 0;
+        const char *const p_key = p_build->pp_keys[i];
+
+        // Stop early if another shard failed
+        if ( atomic_load_explicit(p_shard->p_failed, memory_order_relaxed) ) break;
+
+        // Construct the node from this shard's arena
+        if ( node_construct_in_arena(&p_node, &p_build->p_arenas[p_shard->index], p_key, dict_get(p_build->p_nodes, p_key), 0) == 0 ) break;
+
+        // Store the node in the node graph
+        p_node_graph->_p_nodes[i] = p_node;
+
+        // Store the index of the node
+        p_node->index = i;
+
+        // Store the quantity of names of the node
+        p_build->p_offsets[i + 1] = 1 + p_node->in_quantity + p_node->out_quantity;
+    }
+
+    // Done
+    return ( i == p_shard->end );
+}
+
+int node_build_claim ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+    node_graph *p_node_graph = p_build->p_node_graph;
+
+    // Claim a slot for each name of each node
+    for (size_t i = p_shard->begin; i < p_shard->end; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+        size_t o = p_build->p_offsets[i];
+
+        // Each name
+        for (size_t q = 0; o + q < p_build->p_offsets[i + 1]; q++)
+        {
+
+            // Initialized data
+            const char *p_text = node_build_name(p_node, q);
+            size_t length = strlen(p_text);
+
+            // Store the occurrence
+            p_build->p_occurrences[o + q] = (node_symbol)
+            {
+                .hash   = hash_fnv64(p_text, length),
+                .p_text = p_text,
+                .length = length,
+                .p_node = (void *) 0
+            };
+
+            // Claim a slot
+            node_build_probe(p_build, o + q);
+        }
+    }
+
+    // Success
+    return 1;
+}
+
+int node_build_rank ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+    const size_t *p_slots = p_build->p_node_graph->symbols.p_slots;
+    size_t first_quantity = 0;
+
+    // Find the first occurrence of each name
+    for (size_t o = p_build->p_offsets[p_shard->begin]; o < p_build->p_offsets[p_shard->end]; o++)
+    {
+
+        // Every occurrence is claimed, so the slot holds the first one
+        p_build->p_ids[o] = p_slots[node_build_probe(p_build, o)] - 1;
+
+        // Count the first occurrences
+        first_quantity += ( p_build->p_ids[o] == o );
+    }
+
+    // Store the quantity of symbols first seen in this shard
+    p_build->p_counts[p_shard->index] = first_quantity;
+
+    // Success
+    return 1;
+}
+
+int node_build_assign ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+    node_symbol *p_symbols = p_build->p_node_graph->symbols.p_symbols;
+    size_t id = p_build->p_counts[p_shard->index];
+
+    // Give each first occurrence the next id
+    for (size_t o = p_build->p_offsets[p_shard->begin]; o < p_build->p_offsets[p_shard->end]; o++)
+    {
+
+        // Skip later occurrences
+        if ( p_build->p_ids[o] != o ) continue;
+
+        // Mark the first occurrence
+        p_build->p_firsts[o] = true;
+
+        // Store the symbol
+        p_symbols[id] = p_build->p_occurrences[o];
+
+        // Store the id
+        p_build->p_ids[o] = id++;
+    }
+
+    // Success
+    return 1;
+}
+
+int node_build_bind ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+    node_graph *p_node_graph = p_build->p_node_graph;
+
+    // Store the id of each name of each node
+    for (size_t i = p_shard->begin; i < p_shard->end; i++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[i];
+        size_t o = p_build->p_offsets[i];
+
+        // Later occurrences take the id of the first occurrence
+        for (size_t q = o; q < p_build->p_offsets[i + 1]; q++)
+            if ( p_build->p_firsts[q] == false ) p_build->p_ids[q] = p_build->p_ids[p_build->p_ids[q]];
+
+        // Store the id of the node
+        p_node->id = p_build->p_ids[o];
+
+        // Bind the symbol to the node
+        p_node_graph->symbols.p_symbols[p_node->id].p_node = p_node;
+
+        // Store the id of each port
+        for (size_t j = 0; j < p_node->in_quantity; j++)  p_node->in[j].id  = p_build->p_ids[o + 1 + j];
+        for (size_t j = 0; j < p_node->out_quantity; j++) p_node->out[j].id = p_build->p_ids[o + 1 + p_node->in_quantity + j];
+    }
+
+    // Success
+    return 1;
+}
+
+int node_build_slots ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+    size_t *p_slots = p_build->p_node_graph->symbols.p_slots;
+
+    // Each slot holds a first occurrence. Replace it with the id of its symbol
+    for (size_t i = p_shard->begin; i < p_shard->end; i++)
+        if ( p_slots[i] ) p_slots[i] = p_build->p_ids[p_slots[i] - 1] + 1;
+
+    // Success
+    return 1;
+}
+
+bool node_build_claim_port ( atomic_size_t *p_claim, size_t claim )
+{
+
+    // Initialized data
+    size_t current = 0;
+
+    // Only the first connection to name an input claims it
+    return atomic_compare_exchange_strong(p_claim, &current, claim);
+}
+
+int node_build_resolve ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+    node_graph *p_node_graph = p_build->p_node_graph;
+    atomic_size_t *p_claims = (atomic_size_t *) p_build->p_ids;
+    const char *p_fed = (void *) 0;
+    size_t i = p_shard->begin;
+
+    // Resolve each connection
+    for (; i < p_shard->end; i++)
+    {
+        
+        // Initialized data
+        json_value *p_connection = (void *) 0,
+                   *p_in         = (void *) 0,
+                   *p_out        = (void *) 0;
+        node_build_connection *p_result = &p_build->p_connections[i];
+        array *p_array = (void *) 0;
+
+        // Stop early if another shard failed
+        if ( atomic_load_explicit(p_shard->p_failed, memory_order_relaxed) ) return 1;
+
+        // Store the connection
+        array_index(p_build->p_connection_list, (signed long long) i, (void **)&p_connection);
+
+        // Error check
+        if ( p_connection->type != JSON_VALUE_ARRAY ) goto wrong_connection_type;
+
+        // Store the pair
+        p_array = p_connection->list;
+
+        // Error check
+        if ( array_size(p_array) != 2 ) goto wrong_connection_size;
+
+        // Get the input and output
+        array_index(p_array, 0, (void **) &p_in);
+        array_index(p_array, 1, (void **) &p_out);
+
+        // Type check
+        if ( p_in  == (void *) 0 || p_in->type  != JSON_VALUE_STRING ) goto wrong_port_type;
+        if ( p_out == (void *) 0 || p_out->type != JSON_VALUE_STRING ) goto wrong_port_type;
+
+        // Resolve each side of the connection to a node and a port index
+        if ( node_graph_port_resolve(p_node_graph, p_in->string, false, &p_result->p_node_in, &p_result->out_index) == 0 ) goto failed_to_resolve;
+        if ( node_graph_port_resolve(p_node_graph, p_out->string, true, &p_result->p_node_out, &p_result->in_index) == 0 ) goto failed_to_resolve;
+
+        // Claim the input port. An input is fed by one connection; an output feeds them all
+        if ( node_build_claim_port(&p_claims[p_build->p_offsets[p_result->p_node_out->index] + 1 + p_result->in_index], i + 1) == false ) { p_fed = p_out->string; goto input_fed_twice; }
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Graph errors
+        {
+            wrong_connection_type:
+                #ifndef NDEBUG
+                    log_error("[node] Connection %zu must be of type [ array ] in call to function \"%s\"\n", i, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_connection_size:
+                #ifndef NDEBUG
+                    log_error("[node] Connection %zu must have exactly two ports in call to function \"%s\"\n", i, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] Ports of connection %zu must be of type [ string ] in call to function \"%s\"\n", i, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            input_fed_twice:
+                #ifndef NDEBUG
+                    log_error("[node] Input \"%s\" is fed by more than one connection in call to function \"%s\"\n", p_fed, __FUNCTION__);
+                #else
+                    (void) p_fed;
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_resolve:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_build_link ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_build *p_build = p_shard->p_context;
+
+    // Make each connection. Each input was claimed by one of them
+    for (size_t i = p_shard->begin; i < p_shard->end; i++)
+    {
+
+        // Initialized data
+        const node_build_connection *p_connection = &p_build->p_connections[i];
+        node *p_node_in  = p_connection->p_node_in,
+             *p_node_out = p_connection->p_node_out;
+        size_t j = p_connection->out_index,
+               k = p_connection->in_index;
+
+        // Make the connection to the output
+        p_node_out->in[k].p_in      = p_node_in,
+        p_node_out->in[k].out_index = j;
+    }
+
+    // Success
+    return 1;
+}
+
+void node_build_release ( node_build *const p_build )
+{
+
+    // Release the construction state
+    if ( p_build->p_arenas      ) p_build->p_arenas      = NODE_REALLOC(p_build->p_arenas, 0);
+    if ( p_build->pp_keys       ) p_build->pp_keys       = NODE_REALLOC(p_build->pp_keys, 0);
+    if ( p_build->p_offsets     ) p_build->p_offsets     = NODE_REALLOC(p_build->p_offsets, 0);
+    if ( p_build->p_counts      ) p_build->p_counts      = NODE_REALLOC(p_build->p_counts, 0);
+    if ( p_build->p_occurrences ) p_build->p_occurrences = NODE_REALLOC(p_build->p_occurrences, 0);
+    if ( p_build->p_ids         ) p_build->p_ids         = NODE_REALLOC(p_build->p_ids, 0);
+    if ( p_build->p_firsts      ) p_build->p_firsts      = NODE_REALLOC(p_build->p_firsts, 0);
+    if ( p_build->p_connections ) p_build->p_connections = NODE_REALLOC(p_build->p_connections, 0);
+
+    // Done
+    return;
+}
+
+int node_graph_construct ( node_graph **pp_node_graph, const json_value *const p_value )
+{
+
+    // Argument check
+    if ( pp_node_graph ==        (void *) 0 ) goto no_node_graph;
+    if ( p_value       ==        (void *) 0 ) goto no_value;
+    if ( p_value->type != JSON_VALUE_OBJECT ) goto wrong_type;
+
+    // Initialized data
+    node_graph *p_node_graph = (void *) 0;
+    node_build _build = { 0 };
+    dict *p_dict = p_value->object;
+    json_value *p_nodes       = dict_get(p_dict, "nodes"),
+               *p_connections = dict_get(p_dict, "connections");
+    size_t node_quantity       = 0,
+           name_quantity       = 0,
+           connection_quantity = 0,
+           shard_quantity      = 0;
+
+    // Missing properties
+    if ( p_nodes == (void *) 0 ) goto missing_nodes_value;
+
+    // Type check
+    if ( p_nodes->type != JSON_VALUE_OBJECT ) goto wrong_nodes_type;
+    if ( p_connections && p_connections->type != JSON_VALUE_ARRAY ) goto wrong_connections_type;
+
+    // Store the quantities
+    node_quantity       = dict_keys(p_nodes->object, 0),
+    connection_quantity = ( p_connections ) ? array_size(p_connections->list) : 0,
+    shard_quantity      = node_shard_quantity(node_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0);
+
+    // Error check
+    if ( node_quantity == 0 ) goto no_nodes;
+
+    // Allocate a node graph
+    if ( node_graph_create(&p_node_graph, node_quantity) == 0 ) goto failed_to_allocate_node_graph;
+
+    // Populate the construction state
+    _build = (node_build)
+    {
+        .p_node_graph      = p_node_graph,
+        .p_nodes           = p_nodes->object,
+        .p_connection_list = ( p_connections ) ? p_connections->list : (void *) 0,
+        .p_arenas          = NODE_REALLOC(0, shard_quantity * sizeof(node_arena)),
+        .pp_keys           = NODE_REALLOC(0, node_quantity * sizeof(const char *)),
+        .p_offsets         = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(size_t)),
+        .p_counts          = NODE_REALLOC(0, shard_quantity * sizeof(size_t))
+    };
+
+    // Error check
+    if ( _build.p_arenas  == (void *) 0 ) goto no_mem;
+    if ( _build.pp_keys   == (void *) 0 ) goto no_mem;
+    if ( _build.p_offsets == (void *) 0 ) goto no_mem;
+    if ( _build.p_counts  == (void *) 0 ) goto no_mem;
+
+    // Every shard starts with an empty arena
+    memset(_build.p_arenas, 0, shard_quantity * sizeof(node_arena));
+
+    // No node is constructed until its quantity of names is stored
+    memset(_build.p_offsets, 0, ( node_quantity + 1 ) * sizeof(size_t));
+
+    // Get the key of each node
+    if ( dict_keys(p_nodes->object, _build.pp_keys) == 0 ) goto failed_to_get_keys;
+
+    // Construct each shard of nodes in its own arena
+    if ( node_shards_run(node_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_nodes, &_build) == 0 ) goto failed_to_construct_node;
+
+    // Move the memory of each shard into the graph
+    for (size_t i = 0; i < shard_quantity; i++) node_arena_merge(&p_node_graph->arena, &_build.p_arenas[i]);
+
+    // Each name of node i has a position, starting at offset i
+    for (size_t i = 0; i < node_quantity; i++) _build.p_offsets[i + 1] += _build.p_offsets[i];
+
+    // Store the quantity of names
+    name_quantity = _build.p_offsets[node_quantity];
+
+    // Construct an interner with room for every name, so it never grows
+    if ( node_symbol_table_construct(&p_node_graph->symbols, name_quantity) == 0 ) goto failed_to_construct_symbol_table;
+
+    // Allocate the interning state
+    _build.p_occurrences = NODE_REALLOC(0, name_quantity * sizeof(node_symbol)),
+    _build.p_ids         = NODE_REALLOC(0, name_quantity * sizeof(size_t)),
+    _build.p_firsts      = NODE_REALLOC(0, name_quantity * sizeof(bool));
+
+    // Error check
+    if ( _build.p_occurrences == (void *) 0 ) goto no_mem;
+    if ( _build.p_ids         == (void *) 0 ) goto no_mem;
+    if ( _build.p_firsts      == (void *) 0 ) goto no_mem;
+
+    // No occurrence is first until it is ranked
+    memset(_build.p_firsts, 0, name_quantity * sizeof(bool));
+
+    // Claim a slot for each name. The earliest occurrence of a name keeps its slot
+    if ( node_shards_run(node_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_claim, &_build) == 0 ) goto failed_to_intern;
+
+    // Find the first occurrences, and count them in each shard
+    if ( node_shards_run(node_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_rank, &_build) == 0 ) goto failed_to_intern;
+
+    // The ids of each shard follow the ids of the shards before it
+    for (size_t i = 0; i < shard_quantity; i++)
+    {
+
+        // Initialized data
+        size_t first_quantity = _build.p_counts[i];
+
+        // Store the first id of the shard
+        _build.p_counts[i] = p_node_graph->symbols.quantity;
+
+        // Accumulate the quantity of symbols
+        p_node_graph->symbols.quantity += first_quantity;
+    }
+
+    // Give each symbol an id, in the order its name first occurs
+    if ( node_shards_run(node_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_assign, &_build) == 0 ) goto failed_to_intern;
+
+    // Give every name the id of its symbol
+    if ( node_shards_run(node_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_bind, &_build) == 0 ) goto failed_to_intern;
+
+    // Point each slot at an id
+    if ( node_shards_run(p_node_graph->symbols.capacity * 2, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_slots, &_build) == 0 ) goto failed_to_intern;
+
+    // Parse the connections
+    if ( connection_quantity )
+    {
+
+        // Allocate the resolved connections
+        _build.p_connections = NODE_REALLOC(0, connection_quantity * sizeof(node_build_connection));
+
+        // Error check
+        if ( _build.p_connections == (void *) 0 ) goto no_mem;
+
+        // Reuse the ids to claim ports
+        memset(_build.p_ids, 0, name_quantity * sizeof(size_t));
+
+        // Resolve each connection, and claim its ports
+        if ( node_shards_run(connection_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_resolve, &_build) == 0 ) goto failed_to_resolve;
+
+        // Make each connection on the ports it claimed
+        if ( node_shards_run(connection_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_build_link, &_build) == 0 ) goto failed_to_link;
+    }
+
+    // Release the construction state
+    node_build_release(&_build);
+
+    // Construct the node data, in parallel
+    if ( node_graph_data_construct(p_node_graph, 0) == 0 ) goto failed_to_construct_data;
+
+    // Give each typed output a slot
+    if ( node_graph_values_allocate(p_node_graph, 0) == 0 ) goto failed_to_allocate_values;
+
+    // Return a pointer to the caller
+    *pp_node_graph = p_node_graph;
+
+    // Success
+    return 1;
+
+    failed_to_construct_node:
+
+        // Move the memory of each shard into the graph
+        for (size_t i = 0; i < shard_quantity; i++) node_arena_merge(&p_node_graph->arena, &_build.p_arenas[i]);
+
+        // fall through
+
+    failed_to_get_keys:
+    failed_to_construct_symbol_table:
+    failed_to_intern:
+    failed_to_resolve:
+    failed_to_link:
+    failed_to_construct_data:
+    failed_to_allocate_values:
+
+        // Release the construction state
+        node_build_release(&_build);
+
+        // Release the partial node graph
+        node_graph_destroy(&p_node_graph);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+        
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pp_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[node] Parameter \"p_value\" must be of type [ object ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+ 
+        // Node errors
+        {
+            missing_nodes_value:
+            wrong_nodes_type:
+            no_nodes:
+
+                // Error
+                return 0;
+
+            wrong_connections_type:
+                #ifndef NDEBUG
+                    log_error("[node] Property \"connections\" must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_allocate_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to allocate node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+                
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the construction state
+                node_build_release(&_build);
+
+                // Release the partial node graph
+                node_graph_destroy(&p_node_graph);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+bool node_json_equal ( const json_value *const p_a, const json_value *const p_b )
+{
+
+    // Missing values
+    if ( p_a == (void *) 0 || p_b == (void *) 0 ) return p_a == p_b;
+
+    // Values of different types
+    if ( p_a->type != p_b->type ) return false;
+
+    // Strategy
+    switch ( p_a->type )
+    {
+        case JSON_VALUE_BOOLEAN:
+            return p_a->boolean == p_b->boolean;
+
+        case JSON_VALUE_INTEGER:
+            return p_a->integer == p_b->integer;
+
+        case JSON_VALUE_NUMBER:
+            return memcmp(&p_a->number, &p_b->number, sizeof(p_a->number)) == 0;
+
+        case JSON_VALUE_STRING:
+            return strcmp(p_a->string, p_b->string) == 0;
+
+        case JSON_VALUE_ARRAY:
+        {
+
+            // Initialized data
+            size_t quantity = array_size(p_a->list);
+
+            // Arrays of different sizes
+            if ( quantity != array_size(p_b->list) ) return false;
+
+            // Compare the elements in order
+            for (size_t i = 0; i < quantity; i++)
+            {
+
+                // Initialized data
+                json_value *p_a_element = (void *) 0,
+                           *p_b_element = (void *) 0;
+
+                // Store the elements
+                array_index(p_a->list, (signed long long) i, (void **) &p_a_element);
+                array_index(p_b->list, (signed long long) i, (void **) &p_b_element);
+
+                // Compare
+                if ( node_json_equal(p_a_element, p_b_element) == false ) return false;
+            }
+
+            // Done
+            return true;
+        }
+
+        case JSON_VALUE_OBJECT:
+        {
+
+            // Initialized data
+            size_t quantity = dict_keys(p_a->object, 0);
+            const char *_p_keys[NODE_JSON_KEY_QUANTITY] = { 0 };
+            const char **pp_keys = _p_keys;
+            bool equal = true;
+
+            // Objects with different quantities of properties
+            if ( quantity != dict_keys(p_b->object, 0) ) return false;
+
+            // Allocate memory for the keys of a large object
+            if ( quantity > NODE_JSON_KEY_QUANTITY ) pp_keys = NODE_REALLOC(0, quantity * sizeof(const char *));
+
+            // Error check. Objects that can not be compared are not equal
+            if ( pp_keys == (void *) 0 ) return false;
+
+            // Get the keys
+            if ( quantity ) dict_keys(p_a->object, pp_keys);
+
+            // Compare each property with the property of the same key
+            for (size_t i = 0; i < quantity && equal; i++)
+            {
+
+                // Initialized data
+                const json_value *p_b_property = dict_get(p_b->object, pp_keys[i]);
+
+                // Compare
+                equal = ( p_b_property ) && node_json_equal(dict_get(p_a->object, pp_keys[i]), p_b_property);
+            }
+
+            // Release memory
+            if ( pp_keys != _p_keys ) pp_keys = NODE_REALLOC(pp_keys, 0);
+
+            // Done
+            return equal;
+        }
+
+        default:
+            return true;
+    }
+}
+
+const json_value *node_subgraph_find ( const json_value *const p_value )
+{
+
+    // A graph is an object with a "nodes" object
+    if ( p_value->type == JSON_VALUE_OBJECT )
+    {
+
+        // Initialized data
+        const json_value *p_nodes = dict_get(p_value->object, "nodes");
+        size_t quantity = 0;
+        const char **pp_keys = (void *) 0;
+        const json_value *p_result = (void *) 0;
+
+        // Found
+        if ( p_nodes && p_nodes->type == JSON_VALUE_OBJECT ) return p_value;
+
+        // Search each property
+        quantity = dict_keys(p_value->object, 0);
+        if ( quantity == 0 ) return (void *) 0;
+        pp_keys = NODE_REALLOC(0, quantity * sizeof(const char *));
+        if ( pp_keys == (void *) 0 ) return (void *) 0;
+        dict_keys(p_value->object, pp_keys);
+        for (size_t i = 0; p_result == (void *) 0 && i < quantity; i++)
+            p_result = node_subgraph_find(dict_get(p_value->object, pp_keys[i]));
+
+        // Release memory
+        pp_keys = NODE_REALLOC(pp_keys, 0);
+
+        // Done
+        return p_result;
+    }
+
+    // Search each element
+    if ( p_value->type == JSON_VALUE_ARRAY )
+    {
+
+        // Initialized data
+        size_t quantity = array_size(p_value->list);
+        const json_value *p_result = (void *) 0;
+
+        for (size_t i = 0; p_result == (void *) 0 && i < quantity; i++)
+        {
+
+            // Initialized data
+            json_value *p_element = (void *) 0;
+
+            // Store the element
+            array_index(p_value->list, (signed long long) i, (void **) &p_element);
+
+            // Search the element
+            p_result = node_subgraph_find(p_element);
+        }
+
+        // Done
+        return p_result;
+    }
+
+    // Scalars hold no graphs
+    return (void *) 0;
+}
+
+int node_subgraph_construct ( node *const p_node )
+{
+
+    // Argument check
+    if ( p_node == (void *) 0 ) goto no_node;
+
+    // Initialized data
+    const json_value *p_graph = ( p_node->value ) ? node_subgraph_find(p_node->value) : (void *) 0;
+
+    // Fast exit
+    if ( p_graph == (void *) 0 ) return 1;
+
+    // Construct the subgraph
+    if ( node_graph_construct(&p_node->p_subgraph, p_graph) == 0 ) goto failed_to_construct_subgraph;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_construct_subgraph:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to construct the subgraph of node \"%s\" in call to function \"%s\"\n", p_node->p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_construct_in_arena ( node **pp_node, node_arena *p_arena, const char *const p_name, const json_value *const p_value, fn_node_data_constructor *pfn_node_data_constructor )
+{
+
+    // Argument check
+    if ( pp_node       ==        (void *) 0 ) goto no_node;
+    if ( p_name        ==        (void *) 0 ) goto no_name;
+    if ( p_value       ==        (void *) 0 ) goto no_value;
+    if ( p_value->type != JSON_VALUE_OBJECT ) goto wrong_type;
+
+    // Initialized data
+    node *p_node = (void *) 0;
+    dict *p_dict = p_value->object;
+    json_value *p_out  = dict_get(p_dict, "out"),
+               *p_in   = dict_get(p_dict, "in"),
+               *p_data = dict_get(p_dict, "data"),
+               *p_kind = dict_get(p_dict, "kind");
+    const node_data_kind *p_node_data_kind = (void *) 0;
+    array *p_in_array  = (void *) 0,
+          *p_out_array = (void *) 0;
+    size_t in_quantity  = 0,
+           out_quantity = 0,
+           text_size    = strlen(p_name) + 1;
+    char *p_text = (void *) 0;
+    const char *p_port_type = (void *) 0;
+
+    // Find the kind of the node data
+    if ( p_kind )
+    {
+
+        // Type check
+        if ( p_kind->type != JSON_VALUE_STRING ) goto wrong_kind_type;
+
+        // Find the kind
+        p_node_data_kind = node_data_kind_get(p_kind->string);
+
+        // Error check
+        if ( p_node_data_kind == (void *) 0 ) goto unknown_kind;
+    }
+
+    // Measure the inputs
+    if ( p_in ) 
+    {
+
+        // Type check
+        if ( p_in->type != JSON_VALUE_ARRAY ) goto wrong_in_type;
+
+        // Store the port list
+        p_in_array  = p_in->list;
+        in_quantity = array_size(p_in_array);
+
+        // Accumulate the length of each port name
+        for (size_t i = 0; i < in_quantity; i++)
+        {
+            
+            // Initialized data
+            json_value *i_value = (void *) 0;
+            const char *p_port = (void *) 0;
+
+            // Store the port
+            array_index(p_in_array, (signed long long) i, (void **)&i_value);
+
+            // Type check
+            if ( node_port_split(i_value, &p_port, &p_port_type) == false ) goto wrong_port_type;
+            if ( p_port_type && node_port_type_get(p_port_type) == (void *) 0 ) goto unknown_port_type;
+
+            // Accumulate
+            text_size += strlen(p_port) + 1;
+        }
+    }
+
+    // Measure the outputs
+    if ( p_out ) 
+    {
+
+        // Type check
+        if ( p_out->type != JSON_VALUE_ARRAY ) goto wrong_out_type;
+
+        // Store the port list
+        p_out_array  = p_out->list;
+        out_quantity = array_size(p_out_array);
+
+        // Accumulate the length of each port name
+        for (size_t i = 0; i < out_quantity; i++)
+        {
+            
+            // Initialized data
+            json_value *i_value = (void *) 0;
+            const char *p_port = (void *) 0;
+
+            // Store the port
+            array_index(p_out_array, (signed long long) i, (void **)&i_value);
+
+            // Type check
+            if ( node_port_split(i_value, &p_port, &p_port_type) == false ) goto wrong_port_type;
+            if ( p_port_type && node_port_type_get(p_port_type) == (void *) 0 ) goto unknown_port_type;
+
+            // Accumulate
+            text_size += strlen(p_port) + 1;
+        }
+    }
+
+    // Allocate the node, its ports, and its names in one block
+    if ( node_create(&p_node, p_arena, in_quantity, out_quantity, text_size) == 0 ) goto failed_to_create_node;
+
+    // The name text follows the last output port
+    p_text = (char *) (p_node->out + out_quantity);
+
+    // Construct a node from a json value
+    {
+
+        // Set the name
+        {
+            
+            // Initialized data
+            size_t len = strlen(p_name) + 1;
+
+            // Copy the string
+            memcpy(p_text, p_name, len);
+
+            // Store the name
+            p_node->p_name = p_text;
+
+            // Advance the cursor
+            p_text += len;
+        }
+
+        // Set the in
+        for (size_t i = 0; i < in_quantity; i++)
+        {
+            
+            // Initialized data
+            json_value *i_value = (void *) 0;
+            const char *p_port = (void *) 0;
+            size_t len = 0;
+
+            // Store the port
+            array_index(p_in_array, (signed long long) i, (void **)&i_value);
+            node_port_split(i_value, &p_port, &p_port_type);
+
+            // Compute the length of the name
+            len = strlen(p_port) + 1;
+
+            // Copy the string
+            memcpy(p_text, p_port, len);
+
+            // Store the name and type
+            p_node->in[i].p_name = p_text,
+            p_node->in[i].p_type = node_port_type_get(p_port_type);
+
+            // Advance the cursor
+            p_text += len;
+        }
+
+        // Set the out
+        for (size_t i = 0; i < out_quantity; i++)
+        {
+            
+            // Initialized data
+            json_value *i_value = (void *) 0;
+            const char *p_port = (void *) 0;
+            size_t len = 0;
+
+            // Store the port
+            array_index(p_out_array, (signed long long) i, (void **)&i_value);
+            node_port_split(i_value, &p_port, &p_port_type);
+
+            // Compute the length of the name
+            len = strlen(p_port) + 1;
+
+            // Copy the string
+            memcpy(p_text, p_port, len);
+
+            // Store the name and type. A typed output has the size of its type
+            p_node->out[i].p_name = p_text,
+            p_node->out[i].p_type = node_port_type_get(p_port_type),
+            p_node->out[i].size   = ( p_node->out[i].p_type ) ? p_node->out[i].p_type->size : 0;
+
+            // Advance the cursor
+            p_text += len;
+        }
+
+        // Store the node data
+        p_node->value  = p_data;
+        p_node->p_kind = p_node_data_kind;
+    }
+
+    // Construct the graph nested in the node data, if there is one
+    if ( node_subgraph_construct(p_node) == 0 ) goto failed_to_construct_subgraph;
+
+    // Construct the node data with the caller's constructor. Data of a kind is constructed with the graph
+    if ( pfn_node_data_constructor && p_node_data_kind == (void *) 0 )
+        if ( (*pfn_node_data_constructor)(p_data, &p_node->p_data) == 0 ) goto failed_to_construct_data;
+
+    // Return a pointer to the caller
+    *pp_node = p_node;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument check
+        {
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pp_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+            
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[node] Parameter \"p_value\" must be of type [ object ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            wrong_in_type:
+                #ifndef NDEBUG
+                    log_error("[node] Property \"in\" of node \"%s\" must be of type [ array ] in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_out_type:
+                #ifndef NDEBUG
+                    log_error("[node] Property \"out\" of node \"%s\" must be of type [ array ] in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] Ports of node \"%s\" must be of type [ string ] or { \"name\" : \"type\" } in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" has a port of unregistered type \"%s\" in call to function \"%s\"\n", p_name, p_port_type, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_kind_type:
+                #ifndef NDEBUG
+                    log_error("[node] Property \"kind\" of node \"%s\" must be of type [ string ] in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_kind:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" has unregistered kind \"%s\" in call to function \"%s\"\n", p_name, p_kind->string, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_create_node:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_data:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to construct data of node \"%s\" in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Release the subgraph
+                if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+                // fall through
+
+            failed_to_construct_subgraph:
+
+                // Release the node, unless it belongs to an arena
+                if ( p_arena == (void *) 0 ) p_node = NODE_REALLOC(p_node, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t node_cycle_step ( const node_graph *const p_node_graph, const size_t *const p_indegrees, size_t v )
+{
+
+    // Initialized data
+    const node *p_node = p_node_graph->_p_nodes[v];
+
+    // Step to the first predecessor that was left behind
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+        if ( p_node->in[k].p_in && p_indegrees[p_node->in[k].p_in->index] ) return p_node->in[k].p_in->index;
+
+    // Unreachable for a node on or behind a cycle
+    return v;
+}
+
+void node_dirty_sift_up ( node_graph *const p_node_graph, size_t i )
+{
+
+    // Initialized data
+    node **pp_heap = p_node_graph->dirty.pp_nodes;
+    node *p_node = pp_heap[i];
+
+    // Move the node up past each parent that runs later
+    while ( i )
+    {
+
+        // Initialized data
+        size_t parent = ( i - 1 ) / 2;
+
+        // Done
+        if ( pp_heap[parent]->position <= p_node->position ) break;
+
+        // Move the parent down
+        pp_heap[i] = pp_heap[parent], i = parent;
+    }
+
+    // Store the node
+    pp_heap[i] = p_node;
+}
+
+void node_dirty_sift_down ( node_graph *const p_node_graph, size_t i )
+{
+
+    // Initialized data
+    node **pp_heap = p_node_graph->dirty.pp_nodes;
+    size_t quantity = p_node_graph->dirty.quantity;
+    node *p_node = pp_heap[i];
+
+    // Move the node down past each child that runs sooner
+    for (;;)
+    {
+
+        // Initialized data
+        size_t child = ( 2 * i ) + 1;
+
+        // Done
+        if ( child >= quantity ) break;
+
+        // Pick the child that runs first
+        if ( child + 1 < quantity && pp_heap[child + 1]->position < pp_heap[child]->position ) child++;
+
+        // Done
+        if ( p_node->position <= pp_heap[child]->position ) break;
+
+        // Move the child up
+        pp_heap[i] = pp_heap[child], i = child;
+    }
+
+    // Store the node
+    pp_heap[i] = p_node;
+}
+
+void node_dirty_remove ( node_graph *const p_node_graph, node *const p_node )
+{
+
+    // Initialized data
+    size_t i = 0;
+
+    // Fast exit
+    if ( p_node->dirty == false ) return;
+
+    // Find the node
+    while ( p_node_graph->dirty.pp_nodes[i] != p_node ) i++;
+
+    // Replace it with the last node, then restore the heap
+    p_node_graph->dirty.pp_nodes[i] = p_node_graph->dirty.pp_nodes[--p_node_graph->dirty.quantity];
+    if ( i < p_node_graph->dirty.quantity ) node_dirty_sift_down(p_node_graph, i), node_dirty_sift_up(p_node_graph, i);
+    p_node->dirty = false;
+}
+
+int node_adjacency_rows ( node_adjacency *const p_adjacency, size_t quantity )
+{
+
+    // Fast exit
+    if ( quantity <= p_adjacency->row_capacity ) return 1;
+
+    // Initialized data
+    size_t capacity = ( p_adjacency->row_capacity ) ? p_adjacency->row_capacity * 2 : 64,
+           *p_offsets    = (void *) 0,
+           *p_quantities = (void *) 0,
+           *p_capacities = (void *) 0;
+
+    // Grow to at least the quantity
+    while ( capacity < quantity ) capacity *= 2;
+
+    // Grow each array, storing it as soon as it moves
+    p_offsets = NODE_REALLOC(p_adjacency->p_offsets, capacity * sizeof(size_t));
+    if ( p_offsets == (void *) 0 ) goto no_mem;
+    p_adjacency->p_offsets = p_offsets;
+
+    p_quantities = NODE_REALLOC(p_adjacency->p_quantities, capacity * sizeof(size_t));
+    if ( p_quantities == (void *) 0 ) goto no_mem;
+    p_adjacency->p_quantities = p_quantities;
+
+    p_capacities = NODE_REALLOC(p_adjacency->p_capacities, capacity * sizeof(size_t));
+    if ( p_capacities == (void *) 0 ) goto no_mem;
+    p_adjacency->p_capacities = p_capacities;
+
+    // New rows are empty
+    memset(p_offsets    + p_adjacency->row_capacity, 0, ( capacity - p_adjacency->row_capacity ) * sizeof(size_t));
+    memset(p_quantities + p_adjacency->row_capacity, 0, ( capacity - p_adjacency->row_capacity ) * sizeof(size_t));
+    memset(p_capacities + p_adjacency->row_capacity, 0, ( capacity - p_adjacency->row_capacity ) * sizeof(size_t));
+
+    // Store the capacity
+    p_adjacency->row_capacity = capacity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_adjacency_reserve ( node_adjacency *const p_adjacency, size_t quantity )
+{
+
+    // Fast exit
+    if ( quantity <= p_adjacency->edge_capacity ) return 1;
+
+    // Initialized data
+    size_t capacity = ( p_adjacency->edge_capacity ) ? p_adjacency->edge_capacity * 2 : 256;
+    node_edge *p_edges = (void *) 0;
+
+    // Grow to at least the quantity
+    while ( capacity < quantity ) capacity *= 2;
+
+    // Grow the edges
+    p_edges = NODE_REALLOC(p_adjacency->p_edges, capacity * sizeof(node_edge));
+
+    // Error check
+    if ( p_edges == (void *) 0 ) goto no_mem;
+
+    // Store the edges
+    p_adjacency->p_edges       = p_edges,
+    p_adjacency->edge_capacity = capacity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_adjacency_pack ( node_adjacency *const p_adjacency )
+{
+
+    // Initialized data
+    node_edge *p_edges = NODE_REALLOC(0, p_adjacency->edge_capacity * sizeof(node_edge));
+    size_t used = 0;
+
+    // Error check
+    if ( p_edges == (void *) 0 ) goto no_mem;
+
+    // Copy each run into place, in row order, without room to spare
+    for (size_t i = 0; i < p_adjacency->row_capacity; i++)
+    {
+
+        // Copy the run
+        memcpy(p_edges + used, p_adjacency->p_edges + p_adjacency->p_offsets[i], p_adjacency->p_quantities[i] * sizeof(node_edge));
+
+        // Store the new run
+        p_adjacency->p_offsets[i]    = used,
+        p_adjacency->p_capacities[i] = p_adjacency->p_quantities[i];
+
+        // Advance the cursor
+        used += p_adjacency->p_quantities[i];
+    }
+
+    // Swap in the packed edges
+    p_adjacency->p_edges = NODE_REALLOC(p_adjacency->p_edges, 0),
+    p_adjacency->p_edges = p_edges,
+    p_adjacency->used    = used;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_adjacency_insert ( node_adjacency *const p_adjacency, size_t row, node_edge edge )
+{
+
+    // Make room for the row
+    if ( node_adjacency_rows(p_adjacency, row + 1) == 0 ) goto no_mem;
+
+    // The run is full. Move it to the end of the edges, with twice the room
+    if ( p_adjacency->p_quantities[row] == p_adjacency->p_capacities[row] )
+    {
+
+        // Initialized data
+        size_t capacity = ( p_adjacency->p_capacities[row] ) ? p_adjacency->p_capacities[row] * 2 : 4;
+
+        // Pack the runs first, if most of the used edges were abandoned
+        if ( p_adjacency->used + capacity > p_adjacency->edge_capacity && p_adjacency->edge_quantity * 2 < p_adjacency->used )
+            if ( node_adjacency_pack(p_adjacency) == 0 ) goto no_mem;
+
+        // Make room for the run
+        if ( node_adjacency_reserve(p_adjacency, p_adjacency->used + capacity) == 0 ) goto no_mem;
+
+        // Move the run
+        memcpy(p_adjacency->p_edges + p_adjacency->used, p_adjacency->p_edges + p_adjacency->p_offsets[row], p_adjacency->p_quantities[row] * sizeof(node_edge));
+
+        // Store the new run
+        p_adjacency->p_offsets[row]    = p_adjacency->used,
+        p_adjacency->p_capacities[row] = capacity,
+        p_adjacency->used             += capacity;
+    }
+
+    // Append the edge
+    p_adjacency->p_edges[p_adjacency->p_offsets[row] + p_adjacency->p_quantities[row]++] = edge;
+    p_adjacency->edge_quantity++;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_adjacency_erase ( node_adjacency *const p_adjacency, size_t row, node_edge edge )
+{
+
+    // Initialized data
+    node_edge *p_edges = p_adjacency->p_edges + p_adjacency->p_offsets[row];
+    size_t *p_quantity = &p_adjacency->p_quantities[row];
+
+    // Find the edge, and replace it with the last edge of the run
+    for (size_t i = 0; i < *p_quantity; i++)
+    {
+
+        // Skip other edges
+        if ( p_edges[i].p_node != edge.p_node || p_edges[i].out_index != edge.out_index || p_edges[i].in_index != edge.in_index ) continue;
+
+        // Remove the edge
+        p_edges[i] = p_edges[--*p_quantity];
+        p_adjacency->edge_quantity--;
+
+        // Done
+        return;
+    }
+}
+
+void node_adjacency_move ( node_adjacency *const p_adjacency, size_t from, size_t to )
+{
+
+    // Hand the run of one row to another. The run of the other is abandoned
+    p_adjacency->p_offsets[to]    = p_adjacency->p_offsets[from],
+    p_adjacency->p_quantities[to] = p_adjacency->p_quantities[from],
+    p_adjacency->p_capacities[to] = p_adjacency->p_capacities[from];
+    p_adjacency->p_quantities[from] = 0,
+    p_adjacency->p_capacities[from] = 0;
+}
+
+void node_adjacency_release ( node_adjacency *const p_adjacency )
+{
+
+    // Release the rows and the edges
+    if ( p_adjacency->p_offsets    ) p_adjacency->p_offsets    = NODE_REALLOC(p_adjacency->p_offsets, 0);
+    if ( p_adjacency->p_quantities ) p_adjacency->p_quantities = NODE_REALLOC(p_adjacency->p_quantities, 0);
+    if ( p_adjacency->p_capacities ) p_adjacency->p_capacities = NODE_REALLOC(p_adjacency->p_capacities, 0);
+    if ( p_adjacency->p_edges      ) p_adjacency->p_edges      = NODE_REALLOC(p_adjacency->p_edges, 0);
+
+    // Clear the adjacency
+    *p_adjacency = (node_adjacency) { 0 };
+}
+
+int node_graph_edges_build ( node_graph *const p_node_graph )
+{
+
+    // Initialized data
+    node_adjacency *p_successors   = &p_node_graph->edges.successors,
+                   *p_predecessors = &p_node_graph->edges.predecessors;
+    size_t node_quantity = p_node_graph->node_quantity,
+           edge_quantity = 0;
+
+    // Make room for a row per node
+    if ( node_adjacency_rows(p_successors,   ( node_quantity ) ? node_quantity : 1) == 0 ) goto no_mem;
+    if ( node_adjacency_rows(p_predecessors, ( node_quantity ) ? node_quantity : 1) == 0 ) goto no_mem;
+
+    // Empty every row
+    memset(p_successors->p_quantities,   0, p_successors->row_capacity   * sizeof(size_t));
+    memset(p_successors->p_capacities,   0, p_successors->row_capacity   * sizeof(size_t));
+    memset(p_predecessors->p_quantities, 0, p_predecessors->row_capacity * sizeof(size_t));
+    memset(p_predecessors->p_capacities, 0, p_predecessors->row_capacity * sizeof(size_t));
+
+    // Count the edges of each node
+    for (size_t v = 0; v < node_quantity; v++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[v];
+
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            if ( p_node->in[k].p_in )
+                p_successors->p_capacities[p_node->in[k].p_in->index]++,
+                p_predecessors->p_capacities[v]++,
+                edge_quantity++;
+    }
+
+    // Make room for every edge
+    if ( node_adjacency_reserve(p_successors,   edge_quantity) == 0 ) goto no_mem;
+    if ( node_adjacency_reserve(p_predecessors, edge_quantity) == 0 ) goto no_mem;
+
+    // Prefix sum the counts into offsets
+    for (size_t v = 0, s = 0, p = 0; v < node_quantity; v++)
+        p_successors->p_offsets[v]   = s, s += p_successors->p_capacities[v],
+        p_predecessors->p_offsets[v] = p, p += p_predecessors->p_capacities[v];
+
+    // Fill in the edges, in node and port order
+    for (size_t v = 0; v < node_quantity; v++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            node *p_in = p_node->in[k].p_in;
+            size_t j = p_node->in[k].out_index;
+
+            // Skip unconnected inputs
+            if ( p_in == (void *) 0 ) continue;
+
+            // Store the edge at both ends
+            p_successors->p_edges[p_successors->p_offsets[p_in->index] + p_successors->p_quantities[p_in->index]++] = (node_edge) { .p_node = p_node, .out_index = j, .in_index = k };
+            p_predecessors->p_edges[p_predecessors->p_offsets[v] + p_predecessors->p_quantities[v]++]               = (node_edge) { .p_node = p_in,   .out_index = j, .in_index = k };
+        }
+    }
+
+    // Store the edge counts
+    p_successors->edge_quantity   = p_successors->used   = edge_quantity,
+    p_predecessors->edge_quantity = p_predecessors->used = edge_quantity;
+
+    // The edges match the ports
+    p_node_graph->edges.valid = true;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_flatten ( node_graph *const p_node_graph )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Initialized data
+    size_t node_quantity   = p_node_graph->node_quantity,
+           symbol_quantity = p_node_graph->symbols.quantity,
+           extra_quantity  = 0,
+           inner_quantity  = 0,
+           output_quantity = 0;
+    node **pp_nodes = (void *) 0;
+    size_t *p_bases   = (void *) 0,
+           *p_offsets = (void *) 0,
+           *p_outputs = (void *) 0;
+    node_edge *p_readers = (void *) 0;
+    bool *p_read = (void *) 0;
+
+    // Flatten each subgraph, and count its nodes
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node_graph *p_subgraph = p_node_graph->_p_nodes[i]->p_subgraph;
+        size_t quantity = 0;
+
+        // Skip nodes without a subgraph
+        if ( p_subgraph == (void *) 0 ) continue;
+
+        // Flatten the subgraph first, so nesting of any depth is inlined
+        if ( node_graph_flatten(p_subgraph) == 0 ) goto failed_to_flatten;
+
+        // Count the outputs of the subgraph
+        for (size_t t = 0; t < p_subgraph->node_quantity; t++) quantity += p_subgraph->_p_nodes[t]->out_quantity;
+
+        // Accumulate
+        extra_quantity += p_subgraph->node_quantity;
+        if ( p_subgraph->node_quantity > inner_quantity  ) inner_quantity  = p_subgraph->node_quantity;
+        if ( quantity                  > output_quantity ) output_quantity = quantity;
+    }
+
+    // Fast exit
+    if ( extra_quantity == 0 ) return 1;
+
+    // Grow the node pointers
+    pp_nodes = NODE_REALLOC(p_node_graph->_p_nodes, ( node_quantity + extra_quantity ) * sizeof(node *));
+
+    // Error check
+    if ( pp_nodes == (void *) 0 ) goto no_mem;
+
+    // Store the node pointers
+    p_node_graph->_p_nodes      = pp_nodes,
+    p_node_graph->node_capacity = node_quantity + extra_quantity;
+
+    // Allocate memory
+    p_bases   = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(size_t)),
+    p_offsets = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(size_t)),
+    p_outputs = NODE_REALLOC(0, ( inner_quantity + 1 ) * sizeof(size_t)),
+    p_read    = NODE_REALLOC(0, ( output_quantity + 1 ) * sizeof(bool));
+
+    // Error check
+    if ( p_bases   == (void *) 0 ) goto no_mem;
+    if ( p_offsets == (void *) 0 ) goto no_mem;
+    if ( p_outputs == (void *) 0 ) goto no_mem;
+    if ( p_read    == (void *) 0 ) goto no_mem;
+
+    // Count the readers of each node
+    memset(p_offsets, 0, ( node_quantity + 1 ) * sizeof(size_t));
+    for (size_t v = 0; v < node_quantity; v++)
+        for (size_t k = 0; k < p_node_graph->_p_nodes[v]->in_quantity; k++)
+            if ( p_node_graph->_p_nodes[v]->in[k].p_in ) p_offsets[p_node_graph->_p_nodes[v]->in[k].p_in->index + 1]++;
+
+    // Number the readers of each node
+    for (size_t v = 0; v < node_quantity; v++) p_offsets[v + 1] += p_offsets[v];
+
+    // Allocate memory
+    p_readers = NODE_REALLOC(0, ( p_offsets[node_quantity] + 1 ) * sizeof(node_edge));
+
+    // Error check
+    if ( p_readers == (void *) 0 ) goto no_mem;
+
+    // Store each reader, from the input it reads through. The bases are a cursor until they are set
+    memcpy(p_bases, p_offsets, node_quantity * sizeof(size_t));
+    for (size_t v = 0; v < node_quantity; v++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        // Each connected input
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            if ( p_node->in[k].p_in )
+                p_readers[p_bases[p_node->in[k].p_in->index]++] = (node_edge) { .p_node = p_node, .out_index = p_node->in[k].out_index, .in_index = k };
+    }
+
+    // Copy the inner nodes of each subgraph into the graph. The graph 
+    // is not rewired until every copy is made, so a failure here leaves
+    // it as it was
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_container = p_node_graph->_p_nodes[i];
+        node_graph *p_subgraph = p_container->p_subgraph;
+        size_t base = p_node_graph->node_quantity,
+               container_length = strlen(p_container->p_name);
+
+        // Skip nodes without a subgraph
+        if ( p_subgraph == (void *) 0 ) continue;
+
+        // Store the index of the first inner node
+        p_bases[i] = base;
+
+        // Copy each inner node into the graph, as "container/inner"
+        for (size_t t = 0; t < p_subgraph->node_quantity; t++)
+        {
+
+            // Initialized data
+            const node *p_inner = p_subgraph->_p_nodes[t];
+            node *p_node = (void *) 0;
+            size_t text_size = container_length + 1 + strlen(p_inner->p_name) + 1;
+            char *p_text = (void *) 0;
+
+            // Measure the port names
+            for (size_t k = 0; k < p_inner->in_quantity; k++)  text_size += strlen(p_inner->in[k].p_name) + 1;
+            for (size_t j = 0; j < p_inner->out_quantity; j++) text_size += strlen(p_inner->out[j].p_name) + 1;
+
+            // Allocate the node from the graph arena
+            if ( node_create(&p_node, &p_node_graph->arena, p_inner->in_quantity, p_inner->out_quantity, text_size) == 0 ) goto failed_to_create_node;
+
+            // The name text follows the last output port
+            p_text = (char *) (p_node->out + p_node->out_quantity);
+
+            // Name the node
+            p_node->p_name = p_text;
+            p_text += sprintf(p_text, "%s/%s", p_container->p_name, p_inner->p_name) + 1;
+
+            // Name each port
+            for (size_t k = 0; k < p_inner->in_quantity; k++)  p_node->in[k].p_name  = strcpy(p_text, p_inner->in[k].p_name),  p_text += strlen(p_text) + 1;
+            for (size_t j = 0; j < p_inner->out_quantity; j++) p_node->out[j].p_name = strcpy(p_text, p_inner->out[j].p_name), p_text += strlen(p_text) + 1;
+
+            // Type each port. Typed outputs get slots in this graph
+            for (size_t k = 0; k < p_inner->in_quantity; k++)  p_node->in[k].p_type  = p_inner->in[k].p_type;
+            for (size_t j = 0; j < p_inner->out_quantity; j++) p_node->out[j].p_type = p_inner->out[j].p_type,
+                                                               p_node->out[j].size   = ( p_inner->out[j].p_type ) ? p_inner->out[j].size : 0;
+
+            // Intern the names. Names are bound once nothing can fail
+            if ( node_symbol_table_intern(&p_node_graph->symbols, p_node->p_name, strlen(p_node->p_name), &p_node->id) == 0 ) goto failed_to_intern;
+            for (size_t k = 0; k < p_node->in_quantity; k++)
+                if ( node_symbol_table_intern(&p_node_graph->symbols, p_node->in[k].p_name, strlen(p_node->in[k].p_name), &p_node->in[k].id) == 0 ) goto failed_to_intern;
+            for (size_t j = 0; j < p_node->out_quantity; j++)
+                if ( node_symbol_table_intern(&p_node_graph->symbols, p_node->out[j].p_name, strlen(p_node->out[j].p_name), &p_node->out[j].id) == 0 ) goto failed_to_intern;
+
+            // Store the node
+            p_node->index = p_node_graph->node_quantity;
+            p_node_graph->_p_nodes[p_node_graph->node_quantity++] = p_node;
+        }
+
+        // Copy the inner connections
+        for (size_t t = 0; t < p_subgraph->node_quantity; t++)
+        {
+
+            // Initialized data
+            const node *p_inner = p_subgraph->_p_nodes[t];
+            node *p_node = p_node_graph->_p_nodes[base + t];
+
+            for (size_t k = 0; k < p_inner->in_quantity; k++)
+            {
+
+                // Skip unconnected inputs
+                if ( p_inner->in[k].p_in == (void *) 0 ) continue;
+
+                // Make the connection
+                p_node->in[k].p_in      = p_node_graph->_p_nodes[base + p_inner->in[k].p_in->index],
+                p_node->in[k].out_index = p_inner->in[k].out_index;
+            }
+        }
+    }
+
+    // Give each typed output of the inlined nodes a slot
+    if ( node_graph_values_allocate(p_node_graph, node_quantity) == 0 ) goto no_mem;
+
+    // Nothing fails from here on. Hand the behavior and data of each
+    // inner node to its copy, and bind the name of the copy
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node_graph *p_subgraph = p_node_graph->_p_nodes[i]->p_subgraph;
+
+        // Skip nodes without a subgraph
+        if ( p_subgraph == (void *) 0 ) continue;
+
+        // Each inner node
+        for (size_t t = 0; t < p_subgraph->node_quantity; t++)
+        {
+
+            // Initialized data
+            node *p_inner = p_subgraph->_p_nodes[t],
+                 *p_node  = p_node_graph->_p_nodes[p_bases[i] + t];
+
+            // Take the behavior and data of the inner node
+            p_node->pfn_function       = p_inner->pfn_function,
+            p_node->pfn_batch_function = p_inner->pfn_batch_function,
+            p_node->value              = p_inner->value,
+            p_node->owns_value         = p_inner->owns_value,
+            p_node->memoize            = p_inner->memoize,
+            p_node->p_kind             = p_inner->p_kind,
+            p_node->p_data             = p_inner->p_data;
+            p_inner->owns_value = false,
+            p_inner->p_data     = (void *) 0;
+
+            // Bind the name to the node
+            p_node_graph->symbols.p_symbols[p_node->id].p_node = p_node;
+        }
+    }
+
+    // Move the readers of each container output to the last inner output
+    // of the same name that no inner node reads. Nodes inlined from 
+    // deeper levels come after their containers, so the deepest one wins
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_container = p_node_graph->_p_nodes[i];
+        node_graph *p_subgraph = p_container->p_subgraph;
+        size_t base = p_bases[i];
+
+        // Skip nodes without a subgraph
+        if ( p_subgraph == (void *) 0 ) continue;
+
+        // Number the outputs of each inner node
+        for (size_t t = 0, sum = 0; t < p_subgraph->node_quantity; t++)
+            p_outputs[t] = sum, sum += p_subgraph->_p_nodes[t]->out_quantity;
+
+        // Mark each inner output an inner node reads
+        memset(p_read, 0, ( output_quantity + 1 ) * sizeof(bool));
+        for (size_t t = 0; t < p_subgraph->node_quantity; t++)
+            for (size_t k = 0; k < p_subgraph->_p_nodes[t]->in_quantity; k++)
+                if ( p_subgraph->_p_nodes[t]->in[k].p_in )
+                    p_read[p_outputs[p_subgraph->_p_nodes[t]->in[k].p_in->index] + p_subgraph->_p_nodes[t]->in[k].out_index] = true;
+
+        // Each container output
+        for (size_t j = 0; j < p_container->out_quantity; j++)
+        {
+
+            // Initialized data
+            node *p_from = (void *) 0;
+            size_t jj = 0;
+
+            // Find the inner output
+            for (size_t t = p_subgraph->node_quantity; p_from == (void *) 0 && t-- > 0;)
+                for (jj = 0; jj < p_subgraph->_p_nodes[t]->out_quantity; jj++)
+                    if ( p_node_graph->_p_nodes[base + t]->out[jj].id == p_container->out[j].id && p_read[p_outputs[t] + jj] == false ) { p_from = p_node_graph->_p_nodes[base + t]; break; }
+
+            // Not bridged
+            if ( p_from == (void *) 0 ) continue;
+
+            // Move every reader of the container output to the inner output
+            for (size_t r = p_offsets[i]; r < p_offsets[i + 1]; r++)
+                if ( p_readers[r].out_index == j )
+                    p_readers[r].p_node->in[p_readers[r].in_index].p_in      = p_from,
+                    p_readers[r].p_node->in[p_readers[r].in_index].out_index = jj;
+        }
+    }
+
+    // Bridge each container input to the unconnected inner inputs of the
+    // same name. Readers were moved first, so each container input reads
+    // what it will read in the flat graph
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_container = p_node_graph->_p_nodes[i];
+        node_graph *p_subgraph = p_container->p_subgraph;
+
+        // Skip nodes without a subgraph
+        if ( p_subgraph == (void *) 0 ) continue;
+
+        // Each container input
+        for (size_t k = 0; k < p_container->in_quantity; k++)
+        {
+
+            // Initialized data
+            node *p_in = p_container->in[k].p_in;
+            size_t j = p_container->in[k].out_index;
+            bool bridged = false;
+
+            for (size_t t = p_bases[i]; t < p_bases[i] + p_subgraph->node_quantity; t++)
+            {
+
+                // Initialized data
+                node *p_node = p_node_graph->_p_nodes[t];
+
+                for (size_t kk = 0; kk < p_node->in_quantity; kk++)
+                {
+
+                    // Skip inputs that are connected, or named differently
+                    if ( p_node->in[kk].p_in || p_node->in[kk].id != p_container->in[k].id ) continue;
+
+                    // Make the connection
+                    if ( p_in )
+                        p_node->in[kk].p_in      = p_in,
+                        p_node->in[kk].out_index = j;
+
+                    // Done
+                    bridged = true;
+                }
+            }
+
+            // The container no longer waits on this input
+            if ( bridged ) p_container->in[k].p_in = (void *) 0;
+        }
+
+        // The inner nodes have been copied
+        node_graph_destroy(&p_container->p_subgraph);
+    }
+
+    // Release memory
+    p_bases   = NODE_REALLOC(p_bases, 0),
+    p_offsets = NODE_REALLOC(p_offsets, 0),
+    p_outputs = NODE_REALLOC(p_outputs, 0),
+    p_read    = NODE_REALLOC(p_read, 0),
+    p_readers = NODE_REALLOC(p_readers, 0);
+
+    // The schedule, the order, and the edges no longer match the graph
+    if ( p_node_graph->p_schedule ) p_node_graph->p_schedule = NODE_REALLOC(p_node_graph->p_schedule, 0);
+    p_node_graph->order.ordered = false,
+    p_node_graph->edges.valid   = false;
+
+    // Success
+    return 1;
+
+    failed_to_create_node:
+        #ifndef NDEBUG
+            log_error("[node] Failed to create node in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_copies;
+
+    failed_to_intern:
+        #ifndef NDEBUG
+            log_error("[node] Failed to intern name in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_copies;
+
+    no_mem:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_copies;
+
+    release_copies:
+
+        // Take the copies back out. Their memory stays in the graph arena
+        p_node_graph->node_quantity = node_quantity;
+        node_symbol_table_truncate(&p_node_graph->symbols, symbol_quantity);
+
+        // Release memory
+        if ( p_bases   ) p_bases   = NODE_REALLOC(p_bases, 0);
+        if ( p_offsets ) p_offsets = NODE_REALLOC(p_offsets, 0);
+        if ( p_outputs ) p_outputs = NODE_REALLOC(p_outputs, 0);
+        if ( p_read    ) p_read    = NODE_REALLOC(p_read, 0);
+        if ( p_readers ) p_readers = NODE_REALLOC(p_readers, 0);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_flatten:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to flatten subgraph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_compile ( node_graph *const p_node_graph )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Inline any nested graphs
+    if ( node_graph_flatten(p_node_graph) == 0 ) goto failed_to_flatten;
+
+    // Initialized data
+    size_t node_quantity     = p_node_graph->node_quantity,
+           input_quantity    = 0,
+           edge_quantity     = 0,
+           queued_quantity   = 0,
+           emitted_quantity  = 0;
+    size_t *p_stamps         = NODE_REALLOC(0, node_quantity * sizeof(size_t)),
+           *p_indegrees      = NODE_REALLOC(0, node_quantity * sizeof(size_t)),
+           *p_offsets        = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(size_t)),
+           *p_order          = NODE_REALLOC(0, node_quantity * sizeof(size_t)),
+           *p_positions      = NODE_REALLOC(0, node_quantity * sizeof(size_t)),
+           *p_edges          = (void *) 0;
+    node_schedule *p_schedule = (void *) 0;
+
+    // Error check
+    if ( p_stamps    == (void *) 0 ) goto no_mem;
+    if ( p_indegrees == (void *) 0 ) goto no_mem;
+    if ( p_offsets   == (void *) 0 ) goto no_mem;
+    if ( p_order     == (void *) 0 ) goto no_mem;
+    if ( p_positions == (void *) 0 ) goto no_mem;
+
+    // Initialize memory
+    memset(p_indegrees, 0, node_quantity * sizeof(size_t));
+    memset(p_offsets, 0, ( node_quantity + 1 ) * sizeof(size_t));
+    memset(p_stamps, 0xff, node_quantity * sizeof(size_t));
+
+    // Count distinct predecessors and successors of each node
+    for (size_t v = 0; v < node_quantity; v++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        // Accumulate input slots
+        input_quantity += p_node->in_quantity;
+
+        // Visit each predecessor once
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            node *p_in = p_node->in[k].p_in;
+
+            // Skip unconnected inputs
+            if ( p_in == (void *) 0 ) continue;
+
+            // Skip repeated predecessors
+            if ( p_stamps[p_in->index] == v ) continue;
+
+            // Mark the predecessor
+            p_stamps[p_in->index] = v;
+
+            // Count the edge
+            p_indegrees[v]++,
+            p_offsets[p_in->index + 1]++,
+            edge_quantity++;
+        }
+    }
+
+    // Prefix sum the successor counts
+    for (size_t v = 0; v < node_quantity; v++) p_offsets[v + 1] += p_offsets[v];
+
+    // Allocate the schedule in one block
+    p_schedule = NODE_REALLOC(0, sizeof(node_schedule) + 
+                                 ( node_quantity  * sizeof(node_schedule_entry) ) + 
+                                 ( input_quantity * sizeof(node_output *) ) + 
+                                 ( edge_quantity  * sizeof(size_t) ) );
+
+    // Error check
+    if ( p_schedule == (void *) 0 ) goto no_mem;
+
+    // Carve the arrays out of the allocation
+    *p_schedule = (node_schedule)
+    {
+        .entry_quantity = node_quantity,
+        .p_entries      = (node_schedule_entry *) (p_schedule + 1)
+    };
+    p_schedule->pp_inputs    = (node_output **) (p_schedule->p_entries + node_quantity),
+    p_schedule->p_successors = (size_t *) (p_schedule->pp_inputs + input_quantity);
+
+    // Borrow the successor array to hold the successors by node index
+    p_edges = p_schedule->p_successors;
+
+    // Fill in the successors of each node. Each predecessor's cursor 
+    // is advanced as it is written, and rewound afterward
+    memset(p_stamps, 0xff, node_quantity * sizeof(size_t));
+    for (size_t v = 0; v < node_quantity; v++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        // Visit each predecessor once
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            node *p_in = p_node->in[k].p_in;
+
+            // Skip unconnected inputs and repeated predecessors
+            if ( p_in == (void *) 0 ) continue;
+            if ( p_stamps[p_in->index] == v ) continue;
+
+            // Mark the predecessor
+            p_stamps[p_in->index] = v;
+
+            // Store the successor
+            p_edges[p_offsets[p_in->index]++] = v;
+        }
+    }
+
+    // Rewind the cursors
+    for (size_t v = node_quantity; v > 0; v--) p_offsets[v] = p_offsets[v - 1];
+    p_offsets[0] = 0;
+
+    // Kahn's algorithm. The stamps are free again, and hold the queue
+    for (size_t v = 0; v < node_quantity; v++)
+        if ( p_indegrees[v] == 0 ) p_stamps[queued_quantity++] = v;
+
+    // Release each node's successors as it leaves the queue. When the 
+    // only successor of a node becomes ready, it is emitted right after
+    // the node instead of queued, so that chains stay contiguous
+    for (size_t head = 0; head < queued_quantity; head++)
+    {
+        for (size_t v = p_stamps[head], next = SIZE_MAX; v != SIZE_MAX; v = next, next = SIZE_MAX)
+        {
+
+            // Record the position of the node in the schedule
+            p_order[emitted_quantity] = v,
+            p_positions[v]            = emitted_quantity++;
+
+            // Decrement the indegree of each successor
+            for (size_t e = p_offsets[v]; e < p_offsets[v + 1]; e++)
+            {
+
+                // Skip successors that are still waiting on other inputs
+                if ( --p_indegrees[p_edges[e]] ) continue;
+
+                // Continue the chain, or queue the successor
+                if ( p_offsets[v + 1] - p_offsets[v] == 1 ) next = p_edges[e];
+                else                                        p_stamps[queued_quantity++] = p_edges[e];
+            }
+        }
+    }
+
+    // Error check
+    if ( emitted_quantity != node_quantity ) goto cycle;
+
+    // Rewrite each successor from a node index to a schedule position
+    for (size_t e = 0; e < edge_quantity; e++) p_edges[e] = p_positions[p_edges[e]];
+
+    // Emit the schedule entries
+    for (size_t i = 0, input_offset = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        size_t v = p_order[i];
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        // Resolve each input slot to the output that feeds it
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            p_schedule->pp_inputs[input_offset + k] = ( p_node->in[k].p_in ) ? &p_node->in[k].p_in->out[p_node->in[k].out_index] : (void *) 0;
+
+        // Store the entry
+        p_schedule->p_entries[i] = (node_schedule_entry)
+        {
+            .p_node               = p_node,
+            .index                = v,
+            .input_offset         = input_offset,
+            .predecessor_quantity = 0,
+            .successor_offset     = p_offsets[v],
+            .successor_quantity   = p_offsets[v + 1] - p_offsets[v],
+            .fused_quantity       = 0
+        };
+
+        // Store the position of the node
+        p_node->position = i;
+
+        // Advance the cursor
+        input_offset += p_node->in_quantity;
+    }
+
+    // Count the predecessors of each entry
+    for (size_t e = 0; e < edge_quantity; e++) p_schedule->p_entries[p_edges[e]].predecessor_quantity++;
+
+    // Release the previous schedule, and the buffer plan made from it
+    if ( p_node_graph->p_schedule ) p_node_graph->p_schedule = NODE_REALLOC(p_node_graph->p_schedule, 0);
+    node_graph_plan_release(p_node_graph);
+
+    // Positions have changed, so restore the order of the dirty nodes
+    for (size_t i = p_node_graph->dirty.quantity / 2; i-- > 0;) node_dirty_sift_down(p_node_graph, i);
+
+    // Store the schedule. Its positions are the order edits maintain
+    p_node_graph->p_schedule              = p_schedule,
+    p_node_graph->order.ordered           = true,
+    p_node_graph->order.position_quantity = node_quantity;
+
+    // Release memory
+    p_stamps    = NODE_REALLOC(p_stamps, 0),
+    p_indegrees = NODE_REALLOC(p_indegrees, 0),
+    p_offsets   = NODE_REALLOC(p_offsets, 0),
+    p_order     = NODE_REALLOC(p_order, 0),
+    p_positions = NODE_REALLOC(p_positions, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_flatten:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to flatten node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            cycle:
+                #ifndef NDEBUG
+                {
+
+                    // Initialized data
+                    size_t v = 0, step = 0;
+
+                    // Every node left with a nonzero indegree has a predecessor 
+                    // that was also left behind, so walking predecessors from 
+                    // any of them must eventually revisit a node on a cycle
+                    while ( p_indegrees[v] == 0 ) v++;
+
+                    // Reuse the stamps to record the step each node was visited on
+                    memset(p_stamps, 0xff, node_quantity * sizeof(size_t));
+
+                    // Walk backward until a node repeats
+                    while ( p_stamps[v] == SIZE_MAX ) p_stamps[v] = step++, v = node_cycle_step(p_node_graph, p_indegrees, v);
+
+                    // Log the cycle
+                    log_error("[node] Cycle detected in call to function \"%s\". The following nodes form a cycle:\n", __FUNCTION__);
+
+                    // Walk the cycle once more, printing each node
+                    for (size_t u = v, first = 1; first || u != v; first = 0, u = node_cycle_step(p_node_graph, p_indegrees, u))
+                        log_error("[node]     \"%s\"\n", p_node_graph->_p_nodes[u]->p_name);
+                }
+                #endif
+
+                // Release memory
+                p_schedule  = NODE_REALLOC(p_schedule, 0),
+                p_stamps    = NODE_REALLOC(p_stamps, 0),
+                p_indegrees = NODE_REALLOC(p_indegrees, 0),
+                p_offsets   = NODE_REALLOC(p_offsets, 0),
+                p_order     = NODE_REALLOC(p_order, 0),
+                p_positions = NODE_REALLOC(p_positions, 0);
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                p_stamps    = NODE_REALLOC(p_stamps, 0),
+                p_indegrees = NODE_REALLOC(p_indegrees, 0),
+                p_offsets   = NODE_REALLOC(p_offsets, 0),
+                p_order     = NODE_REALLOC(p_order, 0),
+                p_positions = NODE_REALLOC(p_positions, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_execute ( node_graph *const p_node_graph )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Compile the node graph on first use
+    if ( p_node_graph->p_schedule == (void *) 0 )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Initialized data
+    const node_schedule *const p_schedule = p_node_graph->p_schedule;
+
+    // Walk the schedule
+    for (size_t i = 0; i < p_schedule->entry_quantity; i++)
+    {
+
+        // Run the node
+        if ( node_graph_entry_run(p_node_graph, &p_schedule->p_entries[i]) == 0 ) goto failed_to_execute_node;
+    }
+
+    // Every node is up to date
+    for (size_t i = 0; i < p_node_graph->dirty.quantity; i++) p_node_graph->dirty.pp_nodes[i]->dirty = false;
+    p_node_graph->dirty.quantity = 0;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_execute_node:
+                #ifndef NDEBUG
+                    log_error("[node] Node function returned an error in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_function_run ( node_graph *const p_node_graph, node *const p_node )
+{
+
+    // Run the node through the memo, if there is one
+    if ( p_node_graph->p_memo ) return node_memo_run(p_node_graph->p_memo, p_node);
+
+    // Run the node
+    if ( p_node->pfn_function ) return p_node->pfn_function(p_node);
+
+    // Success
+    return 1;
+}
+
+int node_graph_traced_run ( node_graph *const p_node_graph, node *const p_node )
+{
+
+    // Initialized data
+    uint64_t begin = node_trace_now();
+    int result = node_graph_function_run(p_node_graph, p_node);
+
+    // Record the run on this thread's ring
+    node_trace_record_run(p_node, begin, node_trace_now());
+
+    // Done
+    return result;
+}
+
+int node_graph_entry_run ( node_graph *const p_node_graph, const node_schedule_entry *const p_entry )
+{
+
+    // Initialized data
+    node *const p_node = p_entry->p_node;
+    node_output *const *const pp_inputs = &p_node_graph->p_schedule->pp_inputs[p_entry->input_offset];
+
+    // Load each connected input
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+        if ( pp_inputs[k] ) p_node->in[k].value = pp_inputs[k]->value;
+
+    // Record the run, while tracing
+    #ifdef NODE_TRACE
+        if ( atomic_load_explicit(&node_trace_active, memory_order_relaxed) ) return node_graph_traced_run(p_node_graph, p_node);
+    #endif
+
+    // Run the node
+    return node_graph_function_run(p_node_graph, p_node);
+}
+
+int node_graph_node_run ( node_graph *const p_node_graph, node *const p_node )
+{
+
+    // Load each connected input from the output that feeds it
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+        if ( p_node->in[k].p_in ) p_node->in[k].value = p_node->in[k].p_in->out[p_node->in[k].out_index].value;
+
+    // Record the run, while tracing
+    #ifdef NODE_TRACE
+        if ( atomic_load_explicit(&node_trace_active, memory_order_relaxed) ) return node_graph_traced_run(p_node_graph, p_node);
+    #endif
+
+    // Run the node
+    return node_graph_function_run(p_node_graph, p_node);
+}
+
+int node_graph_dirty_mark ( node_graph *const p_node_graph, node *const p_node )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_node       == (void *) 0 ) goto no_node;
+
+    // Order the node graph on first use. An edited graph stays ordered without a schedule
+    if ( p_node_graph->p_schedule == (void *) 0 && p_node_graph->order.ordered == false )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Fast exit
+    if ( p_node->dirty ) return 1;
+
+    // Grow the heap
+    if ( p_node_graph->dirty.quantity == p_node_graph->dirty.capacity )
+    {
+
+        // Initialized data
+        size_t capacity = ( p_node_graph->dirty.capacity ) ? p_node_graph->dirty.capacity * 2 : 64;
+        node **pp_nodes = NODE_REALLOC(p_node_graph->dirty.pp_nodes, capacity * sizeof(node *));
+
+        // Error check
+        if ( pp_nodes == (void *) 0 ) goto no_mem;
+
+        // Store the allocation
+        p_node_graph->dirty.pp_nodes = pp_nodes,
+        p_node_graph->dirty.capacity = capacity;
+    }
+
+    // Push the node
+    p_node_graph->dirty.pp_nodes[p_node_graph->dirty.quantity++] = p_node;
+    node_dirty_sift_up(p_node_graph, p_node_graph->dirty.quantity - 1);
+
+    // Mark the node
+    p_node->dirty = true;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_update ( node_graph *const p_node_graph )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Order the node graph on first use. An edited graph stays ordered without a schedule
+    if ( p_node_graph->p_schedule == (void *) 0 && p_node_graph->order.ordered == false )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // A buffer plan that aliases outputs has reused the memory of clean values, so every node runs
+    if ( p_node_graph->dirty.quantity && p_node_graph->p_plan && p_node_graph->p_plan->arena_size < p_node_graph->p_plan->unaliased_size )
+        return node_graph_execute(p_node_graph);
+
+    // Build the edges, to find the readers of each node
+    if ( p_node_graph->edges.valid == false )
+        if ( node_graph_edges_build(p_node_graph) == 0 ) goto no_mem;
+
+    // Initialized data
+    const node_schedule *const p_schedule = p_node_graph->p_schedule;
+    const node_adjacency *const p_successors = &p_node_graph->edges.successors;
+
+    // Run the dirty node that comes first in the order, until none are left
+    while ( p_node_graph->dirty.quantity )
+    {
+
+        // Initialized data
+        node *const p_node = p_node_graph->dirty.pp_nodes[0];
+
+        // Pop the node
+        p_node_graph->dirty.pp_nodes[0] = p_node_graph->dirty.pp_nodes[--p_node_graph->dirty.quantity];
+        if ( p_node_graph->dirty.quantity ) node_dirty_sift_down(p_node_graph, 0);
+        p_node->dirty = false;
+
+        // Run the node, from its schedule entry if the graph has not been edited since it was compiled.
+        // On error, it stays dirty for the next update
+        if ( ( ( p_schedule ) ? node_graph_entry_run(p_node_graph, &p_schedule->p_entries[p_node->position])
+                              : node_graph_node_run(p_node_graph, p_node) ) == 0 ) { node_graph_dirty_mark(p_node_graph, p_node); goto failed_to_execute_node; }
+
+        // Everything this node feeds is now out of date
+        for (size_t e = 0; e < p_successors->p_quantities[p_node->index]; e++)
+            if ( node_graph_dirty_mark(p_node_graph, p_successors->p_edges[p_successors->p_offsets[p_node->index] + e].p_node) == 0 ) goto failed_to_mark;
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_execute_node:
+                #ifndef NDEBUG
+                    log_error("[node] Node function returned an error in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_mark:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to mark node dirty in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_edit_order ( node_graph *const p_node_graph )
+{
+
+    // Order the node graph, unless it already is
+    if ( p_node_graph->order.ordered == false )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Build the edges, which edits keep up to date
+    if ( p_node_graph->edges.valid == false )
+        if ( node_graph_edges_build(p_node_graph) == 0 ) goto no_mem;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Graph errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_edit_reserve ( node_graph *const p_node_graph, size_t quantity )
+{
+
+    // Fast exit
+    if ( quantity <= p_node_graph->order.capacity ) return 1;
+
+    // Initialized data
+    size_t capacity = ( p_node_graph->order.capacity ) ? p_node_graph->order.capacity * 2 : 64;
+    node **pp_stack    = (void *) 0,
+         **pp_forward  = (void *) 0,
+         **pp_backward = (void *) 0;
+    size_t *p_positions = (void *) 0;
+
+    // Grow to at least the quantity
+    while ( capacity < quantity ) capacity *= 2;
+
+    // Grow the scratch
+    pp_stack    = NODE_REALLOC(p_node_graph->order.pp_stack, capacity * sizeof(node *));
+    if ( pp_stack == (void *) 0 ) goto no_mem;
+    p_node_graph->order.pp_stack = pp_stack;
+
+    pp_forward  = NODE_REALLOC(p_node_graph->order.pp_forward, capacity * sizeof(node *));
+    if ( pp_forward == (void *) 0 ) goto no_mem;
+    p_node_graph->order.pp_forward = pp_forward;
+
+    pp_backward = NODE_REALLOC(p_node_graph->order.pp_backward, capacity * sizeof(node *));
+    if ( pp_backward == (void *) 0 ) goto no_mem;
+    p_node_graph->order.pp_backward = pp_backward;
+
+    p_positions = NODE_REALLOC(p_node_graph->order.p_positions, 2 * capacity * sizeof(size_t));
+    if ( p_positions == (void *) 0 ) goto no_mem;
+    p_node_graph->order.p_positions = p_positions;
+
+    // Store the capacity
+    p_node_graph->order.capacity = capacity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+size_t node_edit_search ( node_graph *const p_node_graph, node *const p_start, bool forward, size_t bound, const node *const p_target, node **const pp_result, bool *const p_cycle )
+{
+
+    // Initialized data
+    const node_adjacency *p_adjacency = ( forward ) ? &p_node_graph->edges.successors : &p_node_graph->edges.predecessors;
+    node **pp_stack = p_node_graph->order.pp_stack;
+    size_t quantity = 0,
+           top      = 0;
+
+    // Visit the start
+    p_start->visited = true;
+    pp_result[quantity++] = p_start;
+    pp_stack[top++] = p_start;
+
+    // Depth first search. Forward, visit successors placed before the 
+    // bound; backward, visit predecessors placed after it
+    while ( top )
+    {
+
+        // Initialized data
+        node *p_node = pp_stack[--top];
+        const node_edge *p_edges = p_adjacency->p_edges + p_adjacency->p_offsets[p_node->index];
+        size_t edge_quantity = p_adjacency->p_quantities[p_node->index];
+
+        for (size_t e = 0; e < edge_quantity; e++)
+        {
+
+            // Initialized data
+            node *p_next = p_edges[e].p_node;
+
+            // Reaching the target closes a cycle
+            if ( p_next == p_target ) { *p_cycle = true; return quantity; }
+
+            // Skip visited nodes, and nodes outside the affected range
+            if ( p_next->visited ) continue;
+            if ( ( forward ) ? p_next->position > bound : p_next->position < bound ) continue;
+
+            // Visit the node
+            p_next->visited = true;
+            pp_result[quantity++] = p_next;
+            pp_stack[top++] = p_next;
+        }
+    }
+
+    // Done
+    return quantity;
+}
+
+int node_edit_position_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    size_t a = ( *(const node *const *) p_a )->position,
+           b = ( *(const node *const *) p_b )->position;
+
+    // Compare the positions
+    return ( a > b ) - ( a < b );
+}
+
+int node_edit_size_compare ( const void *p_a, const void *p_b )
+{
+
+    // Initialized data
+    size_t a = *(const size_t *) p_a,
+           b = *(const size_t *) p_b;
+
+    // Compare the values
+    return ( a > b ) - ( a < b );
+}
+
+void node_edit_reorder ( node_graph *const p_node_graph, size_t forward_quantity, size_t backward_quantity )
+{
+
+    // Initialized data
+    node **pp_forward  = p_node_graph->order.pp_forward,
+         **pp_backward = p_node_graph->order.pp_backward;
+    size_t *p_positions = p_node_graph->order.p_positions;
+    bool dirty = false;
+
+    // Keep the relative order within each set
+    qsort(pp_backward, backward_quantity, sizeof(node *), node_edit_position_compare);
+    qsort(pp_forward,  forward_quantity,  sizeof(node *), node_edit_position_compare);
+
+    // Pool the positions of both sets
+    for (size_t i = 0; i < backward_quantity; i++) p_positions[i] = pp_backward[i]->position;
+    for (size_t i = 0; i < forward_quantity; i++)  p_positions[backward_quantity + i] = pp_forward[i]->position;
+    qsort(p_positions, backward_quantity + forward_quantity, sizeof(size_t), node_edit_size_compare);
+
+    // Everything that reaches the new edge goes before everything it reaches
+    for (size_t i = 0; i < backward_quantity; i++)
+        pp_backward[i]->position = p_positions[i],
+        pp_backward[i]->visited  = false,
+        dirty |= pp_backward[i]->dirty;
+    for (size_t i = 0; i < forward_quantity; i++)
+        pp_forward[i]->position = p_positions[backward_quantity + i],
+        pp_forward[i]->visited  = false,
+        dirty |= pp_forward[i]->dirty;
+
+    // Positions of dirty nodes have changed, so restore the order of the heap
+    if ( dirty )
+        for (size_t i = p_node_graph->dirty.quantity / 2; i-- > 0;) node_dirty_sift_down(p_node_graph, i);
+}
+
+void node_edit_invalidate ( node_graph *const p_node_graph )
+{
+
+    // The schedule no longer matches the graph. The order still does
+    if ( p_node_graph->p_schedule ) p_node_graph->p_schedule = NODE_REALLOC(p_node_graph->p_schedule, 0);
+
+    // Neither do the lifetimes of the buffers
+    node_graph_plan_release(p_node_graph);
+}
+
+int node_graph_symbol_keep ( node_graph *const p_node_graph, const char *const p_text, size_t *const p_id )
+{
+
+    // Initialized data
+    size_t length = strlen(p_text);
+    char *p_copy = (void *) 0;
+
+    // Fast exit
+    if ( node_symbol_table_find(&p_node_graph->symbols, p_text, length, hash_fnv64(p_text, length), p_id) ) return 1;
+
+    // A new name outlives the node it came from, so it is copied into the graph arena
+    if ( node_arena_allocate(&p_node_graph->arena, length + 1, (void **) &p_copy) == 0 ) return 0;
+    memcpy(p_copy, p_text, length + 1);
+
+    // Intern the copy
+    return node_symbol_table_intern(&p_node_graph->symbols, p_copy, length, p_id);
+}
+
+int node_graph_add_node ( node_graph *const p_node_graph, const char *const p_name, const json_value *const p_value, node **const pp_node )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_name       == (void *) 0 ) goto no_name;
+    if ( p_value      == (void *) 0 ) goto no_value;
+
+    // Initialized data
+    node *p_node = (void *) 0;
+    size_t id = 0,
+           symbol_quantity = 0;
+
+    // Order the graph
+    if ( node_edit_order(p_node_graph) == 0 ) goto failed_to_order;
+
+    // A graph made by node_graph_create has no symbol table yet
+    if ( p_node_graph->symbols.p_slots == (void *) 0 )
+        if ( node_symbol_table_construct(&p_node_graph->symbols, 16) == 0 ) goto failed_to_construct_symbols;
+
+    // Error check
+    if ( node_graph_symbol_get(p_node_graph, p_name, &id) && p_node_graph->symbols.p_symbols[id].p_node ) goto duplicate_node;
+
+    // Construct the node on its own, so that it can be released once it is removed
+    if ( node_construct_in_arena(&p_node, (void *) 0, p_name, p_value, (void *) 0) == 0 ) goto failed_to_construct_node;
+
+    // The node owns its memory
+    p_node->owns_memory = true;
+
+    // Nested graphs are only inlined when a graph is constructed
+    if ( p_node->p_subgraph ) goto nested_graph;
+
+    // Intern the names. Each name interned from here on is taken back on error
+    symbol_quantity = p_node_graph->symbols.quantity;
+    if ( node_graph_symbol_keep(p_node_graph, p_node->p_name, &p_node->id) == 0 ) goto failed_to_intern;
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+        if ( node_graph_symbol_keep(p_node_graph, p_node->in[k].p_name, &p_node->in[k].id) == 0 ) goto failed_to_intern;
+    for (size_t j = 0; j < p_node->out_quantity; j++)
+        if ( node_graph_symbol_keep(p_node_graph, p_node->out[j].p_name, &p_node->out[j].id) == 0 ) goto failed_to_intern;
+
+    // Grow the node pointers
+    if ( p_node_graph->node_quantity == p_node_graph->node_capacity )
+    {
+
+        // Initialized data
+        size_t capacity = p_node_graph->node_capacity * 2;
+        node **pp_nodes = NODE_REALLOC(p_node_graph->_p_nodes, capacity * sizeof(node *));
+
+        // Error check
+        if ( pp_nodes == (void *) 0 ) goto no_mem;
+
+        // Store the node pointers
+        p_node_graph->_p_nodes      = pp_nodes,
+        p_node_graph->node_capacity = capacity;
+    }
+
+    // Make room for the edges of the node
+    if ( node_adjacency_rows(&p_node_graph->edges.successors,   p_node_graph->node_quantity + 1) == 0 ) goto no_mem;
+    if ( node_adjacency_rows(&p_node_graph->edges.predecessors, p_node_graph->node_quantity + 1) == 0 ) goto no_mem;
+
+    // Bind the name to the node
+    p_node_graph->symbols.p_symbols[p_node->id].p_node = p_node;
+
+    // Store the node. Nothing is connected to it, so it can go last in the order
+    p_node->index    = p_node_graph->node_quantity,
+    p_node->position = p_node_graph->order.position_quantity++;
+    p_node_graph->_p_nodes[p_node_graph->node_quantity++] = p_node;
+
+    // Give each typed output a slot
+    if ( node_graph_values_allocate(p_node_graph, p_node->index) == 0 ) goto failed_to_allocate_values;
+
+    // The node has not run yet
+    if ( node_graph_dirty_mark(p_node_graph, p_node) == 0 ) goto failed_to_mark;
+
+    // Construct the data of its kind, once nothing else can fail
+    if ( p_node->p_kind && p_node->p_kind->pfn_constructor(p_node->value, &p_node->p_data) == 0 ) goto failed_to_construct_data;
+
+    // The schedule no longer matches the graph
+    node_edit_invalidate(p_node_graph);
+
+    // Return a pointer to the caller
+    if ( pp_node ) *pp_node = p_node;
+
+    // Success
+    return 1;
+
+    // Unwind what was done, newest first
+    failed_to_construct_data:
+        #ifndef NDEBUG
+            log_error("[node] Failed to construct data of node \"%s\" of kind \"%s\" in call to function \"%s\"\n", p_name, p_node->p_kind->p_name, __FUNCTION__);
+        #endif
+
+        // Nothing was constructed
+        p_node->p_data = (void *) 0;
+
+        // Take the node out of the dirty heap
+        node_dirty_remove(p_node_graph, p_node);
+
+        // Fall through
+        goto remove_node;
+
+    failed_to_mark:
+        #ifndef NDEBUG
+            log_error("[node] Failed to mark node dirty in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto remove_node;
+
+    failed_to_allocate_values:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto remove_node;
+
+    remove_node:
+
+        // Take the node back out of the graph
+        p_node_graph->_p_nodes[--p_node_graph->node_quantity] = (void *) 0,
+        p_node_graph->order.position_quantity--;
+        p_node_graph->symbols.p_symbols[p_node->id].p_node = (void *) 0;
+
+        // Fall through
+        goto release_names;
+
+    failed_to_intern:
+        #ifndef NDEBUG
+            log_error("[node] Failed to intern name in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_names;
+
+    no_mem:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_names;
+
+    release_names:
+
+        // Take back the names interned for the node
+        node_symbol_table_truncate(&p_node_graph->symbols, symbol_quantity);
+
+        // Fall through
+        goto release_node;
+
+    nested_graph:
+        #ifndef NDEBUG
+            log_error("[node] Node \"%s\" holds a nested graph, and can not be added to a graph in call to function \"%s\"\n", p_name, __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto release_node;
+
+    release_node:
+
+        // Release the node, and its nested graph
+        node_destroy(&p_node);
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            duplicate_node:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" is already in the graph in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_construct_node:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to construct node \"%s\" in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_order:
+
+                // Error
+                return 0;
+
+            failed_to_construct_symbols:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to construct symbol table in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_remove_node ( node_graph *const p_node_graph, const char *const p_name )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_name       == (void *) 0 ) goto no_name;
+
+    // Initialized data
+    node_adjacency *p_successors   = &p_node_graph->edges.successors,
+                   *p_predecessors = &p_node_graph->edges.predecessors;
+    node *p_node = (void *) 0,
+         *p_last = (void *) 0;
+
+    // Order the graph
+    if ( node_edit_order(p_node_graph) == 0 ) goto failed_to_order;
+
+    // Find the node
+    if ( node_graph_node_get(p_node_graph, p_name, &p_node) == 0 ) goto unknown_node;
+
+    // Make room to retire the node, before anything changes
+    if ( node_graph_snapshot_reserve(p_node_graph) == 0 ) goto failed_to_retire;
+
+    // Disconnect each input
+    for (size_t e = 0; e < p_predecessors->p_quantities[p_node->index]; e++)
+    {
+
+        // Initialized data
+        const node_edge edge = p_predecessors->p_edges[p_predecessors->p_offsets[p_node->index] + e];
+
+        // Unlink the output that feeds it
+        node_adjacency_erase(p_successors, edge.p_node->index, (node_edge) { .p_node = p_node, .out_index = edge.out_index, .in_index = edge.in_index });
+        p_node->in[edge.in_index].p_in = (void *) 0;
+    }
+
+    // Disconnect each output. What it fed is now out of date
+    for (size_t e = 0; e < p_successors->p_quantities[p_node->index]; e++)
+    {
+
+        // Initialized data
+        const node_edge edge = p_successors->p_edges[p_successors->p_offsets[p_node->index] + e];
+
+        // Unlink the input it feeds
+        node_adjacency_erase(p_predecessors, edge.p_node->index, (node_edge) { .p_node = p_node, .out_index = edge.out_index, .in_index = edge.in_index });
+        edge.p_node->in[edge.in_index].p_in  = (void *) 0,
+        edge.p_node->in[edge.in_index].value = (void *) 0;
+
+        // Mark the reader
+        if ( node_graph_dirty_mark(p_node_graph, edge.p_node) == 0 ) goto failed_to_mark;
+    }
+
+    // The node has no edges left
+    p_successors->edge_quantity   -= p_successors->p_quantities[p_node->index],
+    p_predecessors->edge_quantity -= p_predecessors->p_quantities[p_node->index];
+    p_successors->p_quantities[p_node->index]   = 0,
+    p_predecessors->p_quantities[p_node->index] = 0;
+
+    // Take the node out of the dirty heap
+    node_dirty_remove(p_node_graph, p_node);
+
+    // Release the memo pin
+    if ( p_node->p_memo_entry ) p_node->p_memo_entry->pins--, p_node->p_memo_entry = (void *) 0;
+
+    // Release the nested graph
+    if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+    // Release the constructed data
+    if ( p_node->p_data && p_node->p_kind && p_node->p_kind->pfn_destructor ) p_node->p_kind->pfn_destructor(p_node->p_data);
+    p_node->p_data = (void *) 0;
+
+    // Release the node data
+    if ( p_node->owns_value && p_node->value ) json_value_free(p_node->value);
+    p_node->value = (void *) 0, p_node->owns_value = false;
+
+    // The name no longer refers to a node
+    p_node_graph->symbols.p_symbols[p_node->id].p_node = (void *) 0;
+
+    // Move the last node, and its edges, into the slot of the removed one
+    p_last = p_node_graph->_p_nodes[--p_node_graph->node_quantity];
+    if ( p_last != p_node )
+        node_adjacency_move(p_successors,   p_last->index, p_node->index),
+        node_adjacency_move(p_predecessors, p_last->index, p_node->index);
+    p_node_graph->_p_nodes[p_node->index] = p_last;
+    p_last->index = p_node->index;
+
+    // The schedule no longer matches the graph
+    node_edit_invalidate(p_node_graph);
+
+    // Release the node once no snapshot can point to it
+    node_graph_snapshot_retire(p_node_graph, p_node);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_name:
                 #ifndef NDEBUG
                     log_error("[node] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            unknown_node:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" is not in the graph in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_mark:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to mark node dirty in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_order:
+
+                // Error
+                return 0;
+
+            failed_to_retire:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to make room to retire node \"%s\" in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_edit_connect ( node_graph *const p_node_graph, node *const p_node_from, size_t j, node *const p_node_to, size_t k )
+{
+
+    // Error check
+    if ( p_node_to->in[k].p_in   ) goto input_connected;
+    if ( p_node_from == p_node_to ) goto cycle;
+
+    // The edge runs backward in the order. Repair the order between its ends
+    if ( p_node_from->position > p_node_to->position )
+    {
+
+        // Initialized data
+        size_t forward_quantity  = 0,
+               backward_quantity = 0;
+        bool closes_cycle = false;
+
+        // Make room to visit every node
+        if ( node_edit_reserve(p_node_graph, p_node_graph->node_quantity) == 0 ) goto no_mem;
+
+        // Find what the input reaches, up to the output. Reaching the output closes a cycle
+        forward_quantity = node_edit_search(p_node_graph, p_node_to, true, p_node_from->position, p_node_from, p_node_graph->order.pp_forward, &closes_cycle);
+
+        // Error check
+        if ( closes_cycle )
+        {
+
+            // Clear the marks
+            for (size_t i = 0; i < forward_quantity; i++) p_node_graph->order.pp_forward[i]->visited = false;
+
+            // Error
+            goto cycle;
+        }
+
+        // Find what reaches the output, down to the input
+        backward_quantity = node_edit_search(p_node_graph, p_node_from, false, p_node_to->position, p_node_to, p_node_graph->order.pp_backward, &closes_cycle);
+
+        // Give the affected nodes their new positions
+        node_edit_reorder(p_node_graph, forward_quantity, backward_quantity);
+    }
+
+    // Store the edge at both ends
+    if ( node_adjacency_insert(&p_node_graph->edges.successors, p_node_from->index, (node_edge) { .p_node = p_node_to, .out_index = j, .in_index = k }) == 0 ) goto no_mem;
+    if ( node_adjacency_insert(&p_node_graph->edges.predecessors, p_node_to->index, (node_edge) { .p_node = p_node_from, .out_index = j, .in_index = k }) == 0 )
+    {
+
+        // Take back the first edge
+        node_adjacency_erase(&p_node_graph->edges.successors, p_node_from->index, (node_edge) { .p_node = p_node_to, .out_index = j, .in_index = k });
+
+        // Error
+        goto no_mem;
+    }
+
+    // Make the connection
+    p_node_to->in[k].p_in      = p_node_from,
+    p_node_to->in[k].out_index = j;
+
+    // The schedule no longer matches the graph
+    node_edit_invalidate(p_node_graph);
+
+    // The input has changed
+    if ( node_graph_dirty_mark(p_node_graph, p_node_to) == 0 ) goto failed_to_mark;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Connection errors
+        {
+            input_connected:
+                #ifndef NDEBUG
+                    log_error("[node] Input \"%s:%s\" is already connected in call to function \"%s\"\n", p_node_to->p_name, p_node_to->in[k].p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            cycle:
+                #ifndef NDEBUG
+                    log_error("[node] Connecting \"%s:%s\" to \"%s:%s\" would close a cycle in call to function \"%s\"\n", p_node_from->p_name, p_node_from->out[j].p_name, p_node_to->p_name, p_node_to->in[k].p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            failed_to_mark:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to mark node dirty in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_edit_disconnect ( node_graph *const p_node_graph, node *const p_node_from, size_t j, node *const p_node_to, size_t k )
+{
+
+    // Break the connection. Removing an edge never breaks the order
+    node_adjacency_erase(&p_node_graph->edges.successors,   p_node_from->index, (node_edge) { .p_node = p_node_to,   .out_index = j, .in_index = k });
+    node_adjacency_erase(&p_node_graph->edges.predecessors, p_node_to->index,   (node_edge) { .p_node = p_node_from, .out_index = j, .in_index = k });
+    p_node_to->in[k].p_in  = (void *) 0,
+    p_node_to->in[k].value = (void *) 0;
+
+    // The schedule no longer matches the graph
+    node_edit_invalidate(p_node_graph);
+
+    // The input has changed
+    if ( node_graph_dirty_mark(p_node_graph, p_node_to) == 0 ) goto failed_to_mark;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Node errors
+        {
+            failed_to_mark:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to mark node dirty in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_connect ( node_graph *const p_node_graph, const char *const p_from, const char *const p_to )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_from       == (void *) 0 ) goto no_from;
+    if ( p_to         == (void *) 0 ) goto no_to;
+
+    // Initialized data
+    node *p_node_from = (void *) 0,
+         *p_node_to   = (void *) 0;
+    size_t j = 0,
+           k = 0;
+
+    // Order the graph
+    if ( node_edit_order(p_node_graph) == 0 ) goto failed_to_order;
+
+    // Find the ports
+    if ( node_graph_port_resolve(p_node_graph, p_from, false, &p_node_from, &j) == 0 ) goto failed_to_resolve;
+    if ( node_graph_port_resolve(p_node_graph, p_to,   true,  &p_node_to,   &k) == 0 ) goto failed_to_resolve;
+
+    // Make the connection
+    if ( node_edit_connect(p_node_graph, p_node_from, j, p_node_to, k) == 0 ) goto failed_to_connect;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_from:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_from\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_to:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_to\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Connection errors
+        {
+            failed_to_resolve:
+            failed_to_connect:
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_order:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_disconnect ( node_graph *const p_node_graph, const char *const p_from, const char *const p_to )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_from       == (void *) 0 ) goto no_from;
+    if ( p_to         == (void *) 0 ) goto no_to;
+
+    // Initialized data
+    node *p_node_from = (void *) 0,
+         *p_node_to   = (void *) 0;
+    size_t j = 0,
+           k = 0;
+
+    // Order the graph
+    if ( node_edit_order(p_node_graph) == 0 ) goto failed_to_order;
+
+    // Find the ports
+    if ( node_graph_port_resolve(p_node_graph, p_from, false, &p_node_from, &j) == 0 ) goto failed_to_resolve;
+    if ( node_graph_port_resolve(p_node_graph, p_to,   true,  &p_node_to,   &k) == 0 ) goto failed_to_resolve;
+
+    // Error check
+    if ( p_node_to->in[k].p_in != p_node_from || p_node_to->in[k].out_index != j ) goto not_connected;
+
+    // Break the connection
+    if ( node_edit_disconnect(p_node_graph, p_node_from, j, p_node_to, k) == 0 ) goto failed_to_disconnect;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_from:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_from\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_to:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_to\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Connection errors
+        {
+            failed_to_resolve:
+            failed_to_disconnect:
+
+                // Error
+                return 0;
+
+            not_connected:
+                #ifndef NDEBUG
+                    log_error("[node] Output \"%s\" does not feed input \"%s\" in call to function \"%s\"\n", p_from, p_to, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_order:
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_reload_compare ( const node *const p_node, const char *const p_name, const json_value *const p_value, enum node_reload_change_e *const p_change )
+{
+
+    // Type check
+    if ( p_value == (void *) 0 || p_value->type != JSON_VALUE_OBJECT ) goto wrong_type;
+
+    // Initialized data
+    const json_value *_p_ports[2] = { dict_get(p_value->object, "in"), dict_get(p_value->object, "out") },
+                     *p_kind      = dict_get(p_value->object, "kind"),
+                     *p_data      = dict_get(p_value->object, "data");
+    const node_data_kind *p_node_data_kind = (void *) 0;
+    bool same_ports = ( p_node != (void *) 0 );
+
+    // Find the kind of the node data
+    if ( p_kind )
+    {
+
+        // Type check
+        if ( p_kind->type != JSON_VALUE_STRING ) goto wrong_kind_type;
+
+        // Find the kind
+        p_node_data_kind = node_data_kind_get(p_kind->string);
+
+        // Error check
+        if ( p_node_data_kind == (void *) 0 ) goto unknown_kind;
+    }
+
+    // Compare the inputs, then the outputs, by name and type
+    for (size_t side = 0; side < 2; side++)
+    {
+
+        // Initialized data
+        size_t quantity      = 0,
+               port_quantity = ( p_node == (void *) 0 ) ? 0 : ( side ) ? p_node->out_quantity : p_node->in_quantity;
+
+        // Type check
+        if ( _p_ports[side] && _p_ports[side]->type != JSON_VALUE_ARRAY ) goto wrong_port_type;
+
+        // Store the quantity
+        quantity = ( _p_ports[side] ) ? array_size(_p_ports[side]->list) : 0;
+        if ( quantity != port_quantity ) same_ports = false;
+
+        // Each port
+        for (size_t i = 0; i < quantity; i++)
+        {
+
+            // Initialized data
+            json_value *p_port = (void *) 0;
+            const char *p_port_name = (void *) 0,
+                       *p_port_type = (void *) 0;
+            const node_port_type *p_type = (void *) 0;
+
+            // Store the port
+            array_index(_p_ports[side]->list, (signed long long) i, (void **) &p_port);
+
+            // Split the port into its name and type
+            if ( node_port_split(p_port, &p_port_name, &p_port_type) == false ) goto wrong_port_type;
+
+            // Find the type
+            if ( p_port_type ) p_type = node_port_type_get(p_port_type);
+
+            // Error check
+            if ( p_port_type && p_type == (void *) 0 ) goto unknown_port_type;
+
+            // Compare
+            if ( same_ports )
+                same_ports = ( side ) ? ( strcmp(p_port_name, p_node->out[i].p_name) == 0 && p_type == p_node->out[i].p_type )
+                                      : ( strcmp(p_port_name, p_node->in[i].p_name)  == 0 && p_type == p_node->in[i].p_type );
+        }
+    }
+
+    // Classify the change. A nested graph that borrows its data is built again from the new data
+    if      ( p_node == (void *) 0 )                                          *p_change = NODE_RELOAD_ADD;
+    else if ( same_ports == false || p_node_data_kind != p_node->p_kind )     *p_change = NODE_RELOAD_REPLACE;
+    else if ( p_node->p_subgraph && p_node->owns_value == false )             *p_change = NODE_RELOAD_UPDATE;
+    else if ( node_json_equal(p_node->value, p_data) == false )               *p_change = NODE_RELOAD_UPDATE;
+    else                                                                      *p_change = NODE_RELOAD_SAME;
+
+    // Nested graphs are only inlined when a graph is constructed
+    if ( *p_change >= NODE_RELOAD_REPLACE && p_data && node_subgraph_find(p_data) ) goto nested_graph;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Node errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" must be of type [ object ] in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #else
+                    (void) p_name;
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_kind_type:
+                #ifndef NDEBUG
+                    log_error("[node] Property \"kind\" of node \"%s\" must be of type [ string ] in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #else
+                    (void) p_name;
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_kind:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" has unregistered kind \"%s\" in call to function \"%s\"\n", p_name, p_kind->string, __FUNCTION__);
+                #else
+                    (void) p_name;
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] Each port of node \"%s\" must be of type [ string ] or { \"name\" : \"type\" } in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #else
+                    (void) p_name;
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_port_type:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" has a port of unregistered type in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #else
+                    (void) p_name;
+                #endif
+
+                // Error
+                return 0;
+
+            nested_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Node \"%s\" holds a nested graph, and can only change its data in call to function \"%s\"\n", p_name, __FUNCTION__);
+                #else
+                    (void) p_name;
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_reload_update ( node_graph *const p_node_graph, node *const p_node, const json_value *const p_data )
+{
+
+    // Release the constructed data
+    if ( p_node->p_data && p_node->p_kind && p_node->p_kind->pfn_destructor ) p_node->p_kind->pfn_destructor(p_node->p_data);
+    p_node->p_data = (void *) 0;
+
+    // Release the nested graph
+    if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+    // Release the node data
+    if ( p_node->owns_value && p_node->value ) json_value_free(p_node->value);
+
+    // Borrow the new data. The memo key is hashed again
+    p_node->value      = (json_value *) p_data,
+    p_node->owns_value = false,
+    p_node->data_hash  = 0;
+
+    // Construct the nested graph, and the data of its kind
+    if ( node_subgraph_construct(p_node) == 0 ) goto failed_to_construct_data;
+    if ( p_node->p_kind && p_node->p_kind->pfn_constructor(p_node->value, &p_node->p_data) == 0 ) goto failed_to_construct_data;
+
+    // The node has not run on its new data
+    if ( node_graph_dirty_mark(p_node_graph, p_node) == 0 ) goto failed_to_mark;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Node errors
+        {
+            failed_to_construct_data:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to construct data of node \"%s\" in call to function \"%s\"\n", p_node->p_name, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_mark:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to mark node dirty in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_reload_diff ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_reload *p_reload = p_shard->p_context;
+    node_graph *p_node_graph = p_reload->p_node_graph;
+
+    // Compare each described node with the node of the same name. Each
+    // name is looked up once; the passes after use what is found here
+    for (size_t i = p_shard->begin; i < p_shard->end; i++)
+    {
+
+        // Initialized data
+        const json_value *p_in = (void *) 0;
+        size_t id = 0;
+
+        // Stop early if another shard failed
+        if ( atomic_load_explicit(p_shard->p_failed, memory_order_relaxed) ) return 1;
+
+        // Find the description and the node
+        p_reload->pp_objects[i] = dict_get(p_reload->p_nodes, p_reload->pp_names[i]),
+        p_reload->pp_nodes[i]   = ( node_graph_symbol_get(p_node_graph, p_reload->pp_names[i], &id) ) ? p_node_graph->symbols.p_symbols[id].p_node : (void *) 0;
+
+        // Compare
+        if ( node_reload_compare(p_reload->pp_nodes[i], p_reload->pp_names[i], p_reload->pp_objects[i], &p_reload->p_changes[i]) == 0 ) return 0;
+
+        // Count the described inputs
+        p_in = dict_get(p_reload->pp_objects[i]->object, "in");
+        p_reload->p_starts[i] = ( p_in ) ? array_size(p_in->list) : 0;
+
+        // Mark the node as described
+        if ( p_reload->pp_nodes[i] ) p_reload->p_described[p_reload->pp_nodes[i]->index] = true;
+    }
+
+    // Success
+    return 1;
+}
+
+int node_reload_port_find ( const node_reload *const p_reload, size_t i, const char *const p_text, size_t length, bool input, size_t *const p_index )
+{
+
+    // Initialized data
+    const node *p_node = p_reload->pp_nodes[i];
+    const json_value *p_ports = (void *) 0;
+    size_t quantity = 0;
+
+    // A node that keeps its ports has the described ones
+    if ( p_node && p_reload->p_changes[i] != NODE_RELOAD_REPLACE )
+    {
+
+        // Store the quantity
+        quantity = ( input ) ? p_node->in_quantity : p_node->out_quantity;
+
+        // Search the ports by name
+        for (size_t k = 0; k < quantity; k++)
+        {
+
+            // Initialized data
+            const char *p_name = ( input ) ? p_node->in[k].p_name : p_node->out[k].p_name;
+
+            // Compare
+            if ( strncmp(p_name, p_text, length) == 0 && p_name[length] == '\0' ) return *p_index = k, 1;
+        }
+
+        // Not found
+        return 0;
+    }
+
+    // Otherwise, search the description
+    p_ports  = dict_get(p_reload->pp_objects[i]->object, ( input ) ? "in" : "out"),
+    quantity = ( p_ports ) ? array_size(p_ports->list) : 0;
+
+    // Search the ports by name. Each was checked when the node was compared
+    for (size_t k = 0; k < quantity; k++)
+    {
+
+        // Initialized data
+        json_value *p_port = (void *) 0;
+        const char *p_name = (void *) 0,
+                   *p_type = (void *) 0;
+
+        // Store the port
+        array_index(p_ports->list, (signed long long) k, (void **) &p_port);
+        node_port_split(p_port, &p_name, &p_type);
+
+        // Compare
+        if ( strncmp(p_name, p_text, length) == 0 && p_name[length] == '\0' ) return *p_index = k, 1;
+    }
+
+    // Not found
+    return 0;
+}
+
+int node_reload_resolve ( node_shard *p_shard )
+{
+
+    // Initialized data
+    node_reload *p_reload = p_shard->p_context;
+    const char *p_text = (void *) 0;
+    size_t c = p_shard->begin;
+    bool input = false;
+
+    // Resolve each connection
+    for (; c < p_shard->end; c++)
+    {
+
+        // Initialized data
+        json_value *p_connection = (void *) 0,
+                   *_p_sides[2]  = { 0 };
+        node_reload_connection *p_result = &p_reload->p_connections[c];
+
+        // Stop early if another shard failed
+        if ( atomic_load_explicit(p_shard->p_failed, memory_order_relaxed) ) return 1;
+
+        // Store the connection
+        array_index(p_reload->p_connection_list, (signed long long) c, (void **) &p_connection);
+
+        // Type check
+        if ( p_connection == (void *) 0 || p_connection->type != JSON_VALUE_ARRAY || array_size(p_connection->list) != 2 ) goto wrong_connection_type;
+
+        // Store each side of the connection
+        array_index(p_connection->list, 0, (void **) &_p_sides[0]);
+        array_index(p_connection->list, 1, (void **) &_p_sides[1]);
+
+        // Type check
+        if ( _p_sides[0]->type != JSON_VALUE_STRING || _p_sides[1]->type != JSON_VALUE_STRING ) goto wrong_connection_type;
+
+        // Resolve each side to a described node and a port index
+        for (size_t side = 0; side < 2; side++)
+        {
+
+            // Initialized data
+            const char *p_port_text = strchr(p_text = _p_sides[side]->string, ':');
+            size_t node_length = 0,
+                   i           = 0;
+
+            // The output side comes first
+            input = ( side == 1 );
+
+            // Error check
+            if ( p_port_text == (void *) 0 ) goto malformed;
+
+            // Find the described node
+            node_length = (size_t) ( p_port_text++ - p_text );
+            if ( node_symbol_table_find(&p_reload->names, p_text, node_length, hash_fnv64(p_text, node_length), &i) == 0 ) goto unknown_node;
+
+            // Find the port
+            if ( node_reload_port_find(p_reload, i, p_port_text, strlen(p_port_text), input, ( input ) ? &p_result->in_index : &p_result->out_index) == 0 ) goto unknown_port;
+
+            // Store the node
+            if ( input ) p_result->to   = i, p_result->p_text = p_text;
+            else         p_result->from = i;
+        }
+    }
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Graph errors
+        {
+            wrong_connection_type:
+                #ifndef NDEBUG
+                    log_error("[node] Connection %zu must be of type [ array ] of two strings in call to function \"%s\"\n", c, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Connection errors
+        {
+            malformed:
+                #ifndef NDEBUG
+                    log_error("[node] Connection \"%s\" must be of the form \"node:port\" in call to function \"%s\"\n", p_text, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_node:
+                #ifndef NDEBUG
+                    log_error("[node] Connection \"%s\" refers to a node that is not described in call to function \"%s\"\n", p_text, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            unknown_port:
+                #ifndef NDEBUG
+                    log_error("[node] Connection \"%s\" refers to an unknown %s port in call to function \"%s\"\n", p_text, ( input ) ? "input" : "output", __FUNCTION__);
+                #else
+                    (void) input;
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_reload_acyclic ( const node_reload *const p_reload, size_t name_quantity, size_t connection_quantity )
+{
+
+    // Initialized data
+    size_t *p_offsets = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(size_t)),
+           *p_degrees = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(size_t)),
+           *p_queue   = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(size_t)),
+           *p_targets = NODE_REALLOC(0, ( connection_quantity + 1 ) * sizeof(size_t));
+    size_t head = 0,
+           tail = 0,
+           sum  = 0;
+
+    // Error check
+    if ( p_offsets == (void *) 0 ) goto no_mem;
+    if ( p_degrees == (void *) 0 ) goto no_mem;
+    if ( p_queue   == (void *) 0 ) goto no_mem;
+    if ( p_targets == (void *) 0 ) goto no_mem;
+
+    // Count the successors and the predecessors of each described node
+    memset(p_offsets, 0, ( name_quantity + 1 ) * sizeof(size_t));
+    memset(p_degrees, 0, ( name_quantity + 1 ) * sizeof(size_t));
+    for (size_t c = 0; c < connection_quantity; c++)
+        p_offsets[p_reload->p_connections[c].from]++,
+        p_degrees[p_reload->p_connections[c].to]++;
+
+    // Number the successors of each described node
+    for (size_t i = 0; i < name_quantity; i++)
+    {
+
+        // Initialized data
+        size_t quantity = p_offsets[i];
+
+        // Store the offset
+        p_offsets[i] = sum, sum += quantity;
+    }
+    p_offsets[name_quantity] = sum;
+
+    // Store the successors. Each offset moves to the start of the next row
+    for (size_t c = 0; c < connection_quantity; c++)
+        p_targets[p_offsets[p_reload->p_connections[c].from]++] = p_reload->p_connections[c].to;
+
+    // Start with the nodes that nothing feeds
+    for (size_t i = 0; i < name_quantity; i++)
+        if ( p_degrees[i] == 0 ) p_queue[tail++] = i;
+
+    // Visit each node once every node that feeds it has been visited
+    for (; head < tail; head++)
+    {
+
+        // Initialized data
+        size_t i     = p_queue[head],
+               begin = ( i ) ? p_offsets[i - 1] : 0;
+
+        // Release each successor
+        for (size_t e = begin; e < p_offsets[i]; e++)
+            if ( --p_degrees[p_targets[e]] == 0 ) p_queue[tail++] = p_targets[e];
+    }
+
+    // Release memory
+    p_offsets = NODE_REALLOC(p_offsets, 0),
+    p_degrees = NODE_REALLOC(p_degrees, 0),
+    p_queue   = NODE_REALLOC(p_queue, 0),
+    p_targets = NODE_REALLOC(p_targets, 0);
+
+    // Error check. A node on a cycle is never visited
+    if ( tail < name_quantity ) goto cycle;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Graph errors
+        {
+            cycle:
+                #ifndef NDEBUG
+                    log_error("[node] The described connections form a cycle in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                if ( p_offsets ) p_offsets = NODE_REALLOC(p_offsets, 0);
+                if ( p_degrees ) p_degrees = NODE_REALLOC(p_degrees, 0);
+                if ( p_queue   ) p_queue   = NODE_REALLOC(p_queue, 0);
+                if ( p_targets ) p_targets = NODE_REALLOC(p_targets, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_reload_release ( node_reload *const p_reload )
+{
+
+    // Release the reload state
+    if ( p_reload->pp_names        ) p_reload->pp_names        = NODE_REALLOC(p_reload->pp_names, 0);
+    if ( p_reload->pp_objects      ) p_reload->pp_objects      = NODE_REALLOC(p_reload->pp_objects, 0);
+    if ( p_reload->pp_nodes        ) p_reload->pp_nodes        = NODE_REALLOC(p_reload->pp_nodes, 0);
+    if ( p_reload->p_changes       ) p_reload->p_changes       = NODE_REALLOC(p_reload->p_changes, 0);
+    if ( p_reload->p_starts        ) p_reload->p_starts        = NODE_REALLOC(p_reload->p_starts, 0);
+    if ( p_reload->p_described     ) p_reload->p_described     = NODE_REALLOC(p_reload->p_described, 0);
+    if ( p_reload->names.p_symbols ) p_reload->names.p_symbols = NODE_REALLOC(p_reload->names.p_symbols, 0);
+    if ( p_reload->names.p_slots   ) p_reload->names.p_slots   = NODE_REALLOC(p_reload->names.p_slots, 0);
+    if ( p_reload->p_connections   ) p_reload->p_connections   = NODE_REALLOC(p_reload->p_connections, 0);
+
+    // Done
+    return;
+}
+
+int node_graph_reload ( node_graph *const p_node_graph, const json_value *const p_value, node_reload_report *const p_report )
+{
+
+    // Argument check
+    if ( p_node_graph  ==        (void *) 0 ) goto no_node_graph;
+    if ( p_value       ==        (void *) 0 ) goto no_value;
+    if ( p_value->type != JSON_VALUE_OBJECT ) goto wrong_type;
+
+    // Initialized data
+    node_reload_report _report = { 0 };
+    const json_value *p_nodes       = dict_get(p_value->object, "nodes"),
+                     *p_connections = dict_get(p_value->object, "connections");
+    node_reload _reload = { .p_node_graph = p_node_graph };
+    const char **pp_removed = (void *) 0,
+                *p_input    = (void *) 0;
+    size_t *p_feeds = (void *) 0;
+    size_t name_quantity       = 0,
+           removed_quantity    = 0,
+           connection_quantity = 0,
+           input_quantity      = 0;
+
+    // Missing properties
+    if ( p_nodes == (void *) 0 ) goto missing_nodes_value;
+
+    // Type check
+    if ( p_nodes->type != JSON_VALUE_OBJECT ) goto wrong_nodes_type;
+    if ( p_connections && p_connections->type != JSON_VALUE_ARRAY ) goto wrong_connections_type;
+
+    // Order the graph, and build its edges
+    if ( node_edit_order(p_node_graph) == 0 ) goto failed_to_order;
+
+    // Store the quantities
+    name_quantity       = dict_keys(p_nodes->object, 0),
+    connection_quantity = ( p_connections ) ? array_size(p_connections->list) : 0;
+
+    // Store the description
+    _reload.p_nodes           = p_nodes->object,
+    _reload.p_connection_list = ( p_connections ) ? p_connections->list : (void *) 0;
+
+    // Allocate memory
+    _reload.pp_names      = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(const char *)),
+    _reload.pp_objects    = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(const json_value *)),
+    _reload.pp_nodes      = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(node *)),
+    _reload.p_changes     = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(enum node_reload_change_e)),
+    _reload.p_starts      = NODE_REALLOC(0, ( name_quantity + 1 ) * sizeof(size_t)),
+    _reload.p_described   = NODE_REALLOC(0, ( p_node_graph->node_quantity + 1 ) * sizeof(bool)),
+    _reload.p_connections = NODE_REALLOC(0, ( connection_quantity + 1 ) * sizeof(node_reload_connection)),
+    pp_removed            = NODE_REALLOC(0, ( p_node_graph->node_quantity + 1 ) * sizeof(const char *));
+
+    // Error check
+    if ( _reload.pp_names      == (void *) 0 ) goto no_mem;
+    if ( _reload.pp_objects    == (void *) 0 ) goto no_mem;
+    if ( _reload.pp_nodes      == (void *) 0 ) goto no_mem;
+    if ( _reload.p_changes     == (void *) 0 ) goto no_mem;
+    if ( _reload.p_starts      == (void *) 0 ) goto no_mem;
+    if ( _reload.p_described   == (void *) 0 ) goto no_mem;
+    if ( _reload.p_connections == (void *) 0 ) goto no_mem;
+    if ( pp_removed            == (void *) 0 ) goto no_mem;
+
+    // No node is described yet
+    memset(_reload.p_described, 0, ( p_node_graph->node_quantity + 1 ) * sizeof(bool));
+
+    // Get the names of the nodes
+    if ( name_quantity ) dict_keys(p_nodes->object, _reload.pp_names);
+
+    // Number the names of the nodes. Each is distinct, so its id is its index
+    if ( node_symbol_table_construct(&_reload.names, name_quantity) == 0 ) goto failed;
+    for (size_t i = 0, id = 0; i < name_quantity; i++)
+        if ( node_symbol_table_intern(&_reload.names, _reload.pp_names[i], strlen(_reload.pp_names[i]), &id) == 0 ) goto failed;
+
+    // Compare each described node with the node of the same name
+    if ( node_shards_run(name_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_reload_diff, &_reload) == 0 ) goto failed;
+
+    // Resolve each described connection against the description
+    if ( node_shards_run(connection_quantity, NODE_CONSTRUCT_SHARD_SIZE, 0, node_reload_resolve, &_reload) == 0 ) goto failed;
+
+    // Number the inputs of each described node
+    for (size_t i = 0; i < name_quantity; i++)
+    {
+
+        // Initialized data
+        size_t quantity = _reload.p_starts[i];
+
+        // Store the start
+        _reload.p_starts[i] = input_quantity, input_quantity += quantity;
+    }
+
+    // Allocate memory
+    p_feeds = NODE_REALLOC(0, ( input_quantity + 1 ) * sizeof(size_t));
+
+    // Error check
+    if ( p_feeds == (void *) 0 ) goto no_mem;
+
+    // No input is fed yet
+    memset(p_feeds, 0, ( input_quantity + 1 ) * sizeof(size_t));
+
+    // Find the connection that feeds each described input, plus one
+    for (size_t c = 0; c < connection_quantity; c++)
+    {
+
+        // Initialized data
+        const node_reload_connection *p_connection = &_reload.p_connections[c];
+        size_t *p_feed = &p_feeds[_reload.p_starts[p_connection->to] + p_connection->in_index];
+
+        // Error check
+        if ( *p_feed ) { p_input = p_connection->p_text; goto input_fed_twice; }
+
+        // Feed the input
+        *p_feed = c + 1;
+    }
+
+    // Error check
+    if ( node_reload_acyclic(&_reload, name_quantity, connection_quantity) == 0 ) goto failed;
+
+    // The description is valid. From here on, only running out of memory
+    // leaves the graph between its old state and the described one
+
+    // Find the nodes that are not described
+    for (size_t v = 0; v < p_node_graph->node_quantity; v++)
+        if ( _reload.p_described[v] == false )
+            pp_removed[removed_quantity++] = p_node_graph->symbols.p_symbols[p_node_graph->_p_nodes[v]->id].p_text;
+
+    // Remove them. Their names stay in the graph arena
+    for (size_t r = 0; r < removed_quantity; r++)
+    {
+        if ( node_graph_remove_node(p_node_graph, pp_removed[r]) == 0 ) goto failed;
+        _report.removed_quantity++;
+    }
+
+    // Patch each described node
+    for (size_t i = 0; i < name_quantity; i++)
+    {
+
+        // Initialized data. Removing other nodes does not move this one
+        const char *p_name = _reload.pp_names[i];
+        const json_value *p_object = _reload.pp_objects[i],
+                         *p_data   = dict_get(p_object->object, "data");
+        node *p_node = _reload.pp_nodes[i];
+
+        // Strategy
+        switch ( _reload.p_changes[i] )
+        {
+            case NODE_RELOAD_REPLACE:
+
+                // Remove the node, then add it as described
+                if ( node_graph_remove_node(p_node_graph, p_name) == 0 ) goto failed;
+                if ( node_graph_add_node(p_node_graph, p_name, p_object, &_reload.pp_nodes[i]) == 0 ) goto failed;
+                _report.replaced_quantity++;
+                break;
+
+            case NODE_RELOAD_ADD:
+
+                // Add the node
+                if ( node_graph_add_node(p_node_graph, p_name, p_object, &_reload.pp_nodes[i]) == 0 ) goto failed;
+                _report.added_quantity++;
+                break;
+
+            case NODE_RELOAD_UPDATE:
+
+                // Give the node its new data
+                if ( node_reload_update(p_node_graph, p_node, p_data) == 0 ) goto failed;
+                _report.updated_quantity++;
+                break;
+
+            default:
+
+                // Borrow the equal data of the description
+                if ( p_node->owns_value == false ) p_node->value = (json_value *) p_data;
+                break;
+        }
+    }
+
+    // Disconnect each input that is not fed as described. Every node is
+    // described now, so what is left is part of the described graph, and
+    // no connection made after can close a cycle
+    for (size_t i = 0; i < name_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = _reload.pp_nodes[i];
+
+        // Each input
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            size_t feed = p_feeds[_reload.p_starts[i] + k];
+            const node_reload_connection *p_connection = ( feed ) ? &_reload.p_connections[feed - 1] : (void *) 0;
+
+            // Skip inputs that are fed as described
+            if ( p_node->in[k].p_in == (void *) 0 ) continue;
+            if ( p_connection && p_node->in[k].p_in == _reload.pp_nodes[p_connection->from] && p_node->in[k].out_index == p_connection->out_index ) continue;
+
+            // Disconnect the input
+            if ( node_edit_disconnect(p_node_graph, p_node->in[k].p_in, p_node->in[k].out_index, p_node, k) == 0 ) goto failed;
+            _report.disconnected_quantity++;
+        }
+    }
+
+    // Connect each input that is not fed yet
+    for (size_t i = 0; i < name_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = _reload.pp_nodes[i];
+
+        // Each input
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            size_t feed = p_feeds[_reload.p_starts[i] + k];
+            const node_reload_connection *p_connection = ( feed ) ? &_reload.p_connections[feed - 1] : (void *) 0;
+
+            // Skip inputs that are fed, and inputs that should not be
+            if ( p_connection == (void *) 0 || p_node->in[k].p_in ) continue;
+
+            // Connect the input
+            if ( node_edit_connect(p_node_graph, _reload.pp_nodes[p_connection->from], p_connection->out_index, p_node, k) == 0 ) goto failed;
+            _report.connected_quantity++;
+        }
+    }
+
+    // Release memory
+    node_reload_release(&_reload);
+    pp_removed = NODE_REALLOC(pp_removed, 0),
+    p_feeds    = NODE_REALLOC(p_feeds, 0);
+
+    // Return the report to the caller
+    if ( p_report ) *p_report = _report;
+
+    // Success
+    return 1;
+
+    input_fed_twice:
+        #ifndef NDEBUG
+            log_error("[node] Input \"%s\" is fed by more than one connection in call to function \"%s\"\n", p_input, __FUNCTION__);
+        #else
+            (void) p_input;
+        #endif
+
+        // Fall through
+        goto failed;
+
+    no_mem:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // Fall through
+        goto failed;
+
+    failed:
+
+        // Release memory
+        node_reload_release(&_reload);
+        if ( pp_removed ) pp_removed = NODE_REALLOC(pp_removed, 0);
+        if ( p_feeds    ) p_feeds    = NODE_REALLOC(p_feeds, 0);
+
+        // Return what was changed to the caller
+        if ( p_report ) *p_report = _report;
+
+        // Error
+        return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
                 // Error
                 return 0;
 
@@ -522,7 +5625,7 @@ int node_construct ( node **pp_node, const char *const p_name, const json_value
 
                 // Error
                 return 0;
-            
+
             wrong_type:
                 #ifndef NDEBUG
                     log_error("[node] Parameter \"p_value\" must be of type [ object ] in call to function \"%s\"\n", __FUNCTION__);
@@ -532,87 +5635,233 @@ int node_construct ( node **pp_node, const char *const p_name, const json_value
                 return 0;
         }
 
-        // Node errors
+        // Graph errors
         {
-            failed_to_create_node:
+            missing_nodes_value:
                 #ifndef NDEBUG
-                    log_error("[node] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                    log_error("[node] Parameter \"p_value\" has no property \"nodes\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_nodes_type:
+                #ifndef NDEBUG
+                    log_error("[node] Property \"nodes\" must be of type [ object ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            wrong_connections_type:
+                #ifndef NDEBUG
+                    log_error("[node] Property \"connections\" must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
+                // Error
+                return 0;
+
+            failed_to_order:
+
                 // Error
                 return 0;
         }
     }
 }
 
-int node_graph_print ( const node_graph *const p_node_graph )
+int node_graph_node_get ( const node_graph *const p_node_graph, const char *const p_name, node **const pp_node )
 {
 
     // Argument check
     if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_name       == (void *) 0 ) goto no_name;
+    if ( pp_node      == (void *) 0 ) goto no_node;
 
-    // Print the node graph
-    log_info("=== node graph @ %p ===\n", p_node_graph);
-    printf(" - nodes: \n");
+    // Initialized data
+    size_t id = 0;
 
-    // Print each node 
-    for (size_t i = 0; i < p_node_graph->node_quantity; i++)
+    // Find the symbol
+    if ( node_graph_symbol_get(p_node_graph, p_name, &id) == 0 ) return 0;
+
+    // Error check
+    if ( p_node_graph->symbols.p_symbols[id].p_node == (void *) 0 ) return 0;
+
+    // Return a pointer to the caller
+    *pp_node = p_node_graph->symbols.p_symbols[id].p_node;
+
+    // Success
+    return 1;
+
+    // Error handling
     {
 
-        // Print the name of the node
-        printf("      - %s:\n", p_node_graph->_p_nodes[i]->_name);
-        if ( p_node_graph->_p_nodes[i]->value )
+        // Argument errors
         {
-            printf("        - data: ");
-            json_value_print(p_node_graph->_p_nodes[i]->value);
-            putchar('\n');
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pp_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
         }
-        
-        if ( p_node_graph->_p_nodes[i]->out_quantity == 0 ) goto no_outputs;
+    }
+}
+
+int node_graph_symbol_get ( const node_graph *const p_node_graph, const char *const p_name, size_t *const p_id )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_name       == (void *) 0 ) goto no_name;
+    if ( p_id         == (void *) 0 ) goto no_id;
+
+    // Initialized data
+    size_t length = strlen(p_name);
+
+    // Find the symbol
+    return node_symbol_table_find(&p_node_graph->symbols, p_name, length, hash_fnv64(p_name, length), p_id);
 
-        // Print the outputs
-        log_info("        - out:\n");
+    // Error handling
+    {
 
-        // Iterate through each output
-        for (size_t j = 0; j < p_node_graph->_p_nodes[i]->out_quantity; j++)
+        // Argument errors
         {
-            
-            log_info("           %s", p_node_graph->_p_nodes[i]->out[j]._name);
-            // Print the output and input
-            printf(" >>> ");
-            log_error("%s:%s\n",
-                //p_node_graph->_p_nodes[i]->_name,
-                //p_node_graph->_p_nodes[i]->out[j]._name//,
-                p_node_graph->_p_nodes[i]->out[j].p_out->_name,
-                p_node_graph->_p_nodes[i]->out[j].p_out->in[p_node_graph->_p_nodes[i]->out[j].in_index]._name
-            );
-        }   
-        
-        no_outputs:
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_id:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_id\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_edges_get ( node_graph *const p_node_graph, const node *const p_node, bool successors, const node_edge **const pp_edges, size_t *const p_quantity )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( p_node       == (void *) 0 ) goto no_node;
+    if ( pp_edges     == (void *) 0 ) goto no_edges;
+    if ( p_quantity   == (void *) 0 ) goto no_quantity;
+
+    // Build the edges on first use
+    if ( p_node_graph->edges.valid == false )
+        if ( node_graph_edges_build(p_node_graph) == 0 ) goto failed_to_build_edges;
+
+    // Initialized data
+    const node_adjacency *p_adjacency = ( successors ) ? &p_node_graph->edges.successors : &p_node_graph->edges.predecessors;
+
+    // Return the run to the caller
+    *pp_edges   = p_adjacency->p_edges + p_adjacency->p_offsets[p_node->index],
+    *p_quantity = p_adjacency->p_quantities[p_node->index];
 
-        // State check
-        if ( p_node_graph->_p_nodes[i]->in_quantity == 0 ) goto no_inputs;
+    // Success
+    return 1;
 
-        // Print the inputs
-        log_error("        - in:\n");
+    // Error handling
+    {
 
-        // Iterate through each node
-        for (size_t j = 0; j < p_node_graph->_p_nodes[i]->in_quantity; j++)
+        // Argument errors
         {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_edges:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pp_edges\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_quantity:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"p_quantity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
 
-            // Print the input and output
-            log_error("           %s", p_node_graph->_p_nodes[i]->in[j]._name);
+        // Graph errors
+        {
+            failed_to_build_edges:
+                #ifndef NDEBUG
+                    log_error("[node] Failed to build edges in call to function \"%s\"\n", __FUNCTION__);
+                #endif
 
-            printf(" <<< ");
-            log_info("%s:%s\n",
-                p_node_graph->_p_nodes[i]->in[j].p_in->_name,
-                p_node_graph->_p_nodes[i]->in[j].p_in->out[p_node_graph->_p_nodes[i]->in[j].out_index]._name,
-                p_node_graph->_p_nodes[i]->_name,
-                p_node_graph->_p_nodes[i]->in[j]._name
-            );
+                // Error
+                return 0;
         }
-        no_inputs:;
     }
+}
+
+int node_construct ( node **pp_node, const char *const p_name, const json_value *const p_value, fn_node_data_constructor *pfn_node_data_constructor )
+{
+
+    // Construct the node on the heap
+    return node_construct_in_arena(pp_node, (void *) 0, p_name, p_value, pfn_node_data_constructor);
+}
+
+int node_graph_print ( const node_graph *const p_node_graph )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Print the node graph as json, through one buffer
+    if ( node_graph_export(p_node_graph, NODE_EXPORT_JSON, stdout) == 0 ) return 0;
+
+    // Write it out
+    fflush(stdout);
 
     // Success
     return 1;
@@ -632,3 +5881,134 @@ int node_graph_print ( const node_graph *const p_node_graph )
         }
     }
 }
+
+int node_destroy ( node **const pp_node )
+{
+
+    // Argument check
+    if ( pp_node  == (void *) 0 ) goto no_node;
+    if ( *pp_node == (void *) 0 ) goto no_node;
+
+    // Release the subgraph
+    if ( (*pp_node)->p_subgraph ) node_graph_destroy(&(*pp_node)->p_subgraph);
+
+    // Release the constructed data
+    if ( (*pp_node)->p_data && (*pp_node)->p_kind && (*pp_node)->p_kind->pfn_destructor ) (*pp_node)->p_kind->pfn_destructor((*pp_node)->p_data);
+
+    // Release the node data
+    if ( (*pp_node)->owns_value && (*pp_node)->value ) json_value_free((*pp_node)->value);
+
+    // Release the node, its ports, and its names
+    *pp_node = NODE_REALLOC(*pp_node, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pp_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_destroy ( node_graph **const pp_node_graph )
+{
+
+    // Argument check
+    if ( pp_node_graph  == (void *) 0 ) goto no_node_graph;
+    if ( *pp_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Initialized data
+    node_graph *p_node_graph = *pp_node_graph;
+
+    // No more pointer for caller
+    *pp_node_graph = (void *) 0;
+
+    // Release the buffer plan, while its nodes are still there
+    node_graph_plan_release(p_node_graph);
+
+    // Release the snapshots
+    node_graph_snapshot_release(p_node_graph);
+
+    // Release the subgraphs and data of each node
+    for (size_t i = 0; i < p_node_graph->node_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[i];
+
+        // Skip slots that were never filled
+        if ( p_node == (void *) 0 ) continue;
+
+        // Release the subgraph
+        if ( p_node->p_subgraph ) node_graph_destroy(&p_node->p_subgraph);
+
+        // Release the constructed data
+        if ( p_node->p_data && p_node->p_kind && p_node->p_kind->pfn_destructor ) p_node->p_kind->pfn_destructor(p_node->p_data), p_node->p_data = (void *) 0;
+
+        // Release the node data
+        if ( p_node->owns_value && p_node->value ) json_value_free(p_node->value), p_node->value = (void *) 0;
+
+        // Release the node, if it was allocated on its own
+        if ( p_node->owns_memory ) p_node_graph->_p_nodes[i] = NODE_REALLOC(p_node, 0);
+    }
+
+    // Release the nodes, their ports, and their names
+    node_arena_release(&p_node_graph->arena);
+
+    // Release the values of typed outputs
+    node_arena_release(&p_node_graph->values);
+
+    // Release the symbol table
+    if ( p_node_graph->symbols.p_symbols ) p_node_graph->symbols.p_symbols = NODE_REALLOC(p_node_graph->symbols.p_symbols, 0);
+    if ( p_node_graph->symbols.p_slots   ) p_node_graph->symbols.p_slots   = NODE_REALLOC(p_node_graph->symbols.p_slots, 0);
+
+    // Release the schedule
+    if ( p_node_graph->p_schedule ) p_node_graph->p_schedule = NODE_REALLOC(p_node_graph->p_schedule, 0);
+
+    // Release the dirty heap
+    if ( p_node_graph->dirty.pp_nodes ) p_node_graph->dirty.pp_nodes = NODE_REALLOC(p_node_graph->dirty.pp_nodes, 0);
+
+    // Release the edges
+    node_adjacency_release(&p_node_graph->edges.successors);
+    node_adjacency_release(&p_node_graph->edges.predecessors);
+
+    // Release the order scratch
+    if ( p_node_graph->order.pp_stack    ) p_node_graph->order.pp_stack    = NODE_REALLOC(p_node_graph->order.pp_stack, 0);
+    if ( p_node_graph->order.pp_forward  ) p_node_graph->order.pp_forward  = NODE_REALLOC(p_node_graph->order.pp_forward, 0);
+    if ( p_node_graph->order.pp_backward ) p_node_graph->order.pp_backward = NODE_REALLOC(p_node_graph->order.pp_backward, 0);
+    if ( p_node_graph->order.p_positions ) p_node_graph->order.p_positions = NODE_REALLOC(p_node_graph->order.p_positions, 0);
+
+    // Release the node pointers
+    p_node_graph->_p_nodes = NODE_REALLOC(p_node_graph->_p_nodes, 0);
+
+    // Release the node graph
+    p_node_graph = NODE_REALLOC(p_node_graph, 0);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] Null pointer provided for parameter \"pp_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,426 @@
+/** !
+ * Optimization passes over node graphs
+ *
+ * @file optimize.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/optimize.h>
+
+// Preprocessor definitions
+#define NODE_OPTIMIZE_STATE_SINK   1
+#define NODE_OPTIMIZE_STATE_LIVE   2
+#define NODE_OPTIMIZE_STATE_MERGED 4
+
+// Function definitions
+bool node_optimize_mergeable ( const node *const p_node )
+{
+
+    // Nodes without a function or data are fed by the caller
+    if ( p_node->pfn_function == (void *) 0 && p_node->pfn_batch_function == (void *) 0 && p_node->value == (void *) 0 ) return false;
+
+    // So are nodes with an unconnected input
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+        if ( p_node->in[k].p_in == (void *) 0 ) return false;
+
+    // Containers are left as they are
+    if ( p_node->p_subgraph ) return false;
+
+    // Done
+    return true;
+}
+
+const node *node_optimize_kept ( const node *const *const pp_kept, const node *const p_node )
+{
+
+    // A merged node reads as the node it was merged into
+    return ( pp_kept[p_node->index] ) ? pp_kept[p_node->index] : p_node;
+}
+
+hash64 node_optimize_hash ( const node *const *const pp_kept, const node *const p_node )
+{
+
+    // Initialized data
+    hash64 h = node_memo_mix((hash64) (uintptr_t) p_node->pfn_function, (hash64) (uintptr_t) p_node->pfn_batch_function);
+
+    // Mix in the kind and the shape of the node
+    h = node_memo_mix(h, (hash64) (uintptr_t) p_node->p_kind),
+    h = node_memo_mix(h, p_node->in_quantity),
+    h = node_memo_mix(h, p_node->out_quantity);
+
+    // Mix in each input, and the output that feeds it
+    for (size_t k = 0; k < p_node->in_quantity; k++)
+        h = node_memo_mix(h, p_node->in[k].id),
+        h = node_memo_mix(h, node_optimize_kept(pp_kept, p_node->in[k].p_in)->index),
+        h = node_memo_mix(h, p_node->in[k].out_index);
+
+    // Mix in each output
+    for (size_t j = 0; j < p_node->out_quantity; j++)
+        h = node_memo_mix(h, p_node->out[j].id);
+
+    // Mix in the data
+    if ( p_node->value ) h = node_memo_mix(h, node_memo_json_hash(p_node->value));
+
+    // Done
+    return h;
+}
+
+bool node_optimize_equal ( const node *const *const pp_kept, const node *const p_a, const node *const p_b )
+{
+
+    // Compare the function, kind and shape of the nodes
+    if ( p_a->pfn_function       != p_b->pfn_function       ) return false;
+    if ( p_a->pfn_batch_function != p_b->pfn_batch_function ) return false;
+    if ( p_a->p_kind             != p_b->p_kind             ) return false;
+    if ( p_a->memoize            != p_b->memoize            ) return false;
+    if ( p_a->in_quantity        != p_b->in_quantity        ) return false;
+    if ( p_a->out_quantity       != p_b->out_quantity       ) return false;
+
+    // Compare each input, and the output that feeds it
+    for (size_t k = 0; k < p_a->in_quantity; k++)
+    {
+        if ( p_a->in[k].id        != p_b->in[k].id        ) return false;
+        if ( node_optimize_kept(pp_kept, p_a->in[k].p_in) != node_optimize_kept(pp_kept, p_b->in[k].p_in) ) return false;
+        if ( p_a->in[k].out_index != p_b->in[k].out_index ) return false;
+    }
+
+    // Compare each output
+    for (size_t j = 0; j < p_a->out_quantity; j++)
+        if ( p_a->out[j].id != p_b->out[j].id ) return false;
+
+    // Compare the data
+    return node_json_equal(p_a->value, p_b->value);
+}
+
+int node_graph_optimize ( node_graph *const p_node_graph, const char *const *const pp_sinks, size_t sink_quantity, int passes, node_optimize_report *const p_report )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( pp_sinks == (void *) 0 && sink_quantity ) goto no_sinks;
+
+    // Initialized data
+    node_optimize_report _report = { 0 };
+    node_schedule *p_schedule = (void *) 0;
+    size_t node_quantity = 0,
+           table_mask    = 0;
+    unsigned char *p_states = (void *) 0;
+    node **pp_kept = (void *) 0;
+    hash64 *p_hashes = (void *) 0;
+    size_t *p_table = (void *) 0;
+    const char *p_sink = (void *) 0;
+
+    // Compile the node graph, so that its nodes are flat, and in schedule order
+    if ( p_node_graph->p_schedule == (void *) 0 )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Store the schedule and the size of the graph
+    p_schedule    = p_node_graph->p_schedule,
+    node_quantity = p_node_graph->node_quantity;
+
+    // Size the table of distinct nodes, at no more than half full
+    for (table_mask = 16; table_mask < node_quantity * 2; table_mask *= 2);
+
+    // Allocate memory
+    p_states          = NODE_REALLOC(0, node_quantity + 1),
+    pp_kept           = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(node *)),
+    p_hashes          = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(hash64)),
+    p_table           = NODE_REALLOC(0, table_mask * sizeof(size_t)),
+    _report.pp_removed = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(const char *));
+
+    // Error check
+    if ( p_states           == (void *) 0 ) goto no_mem;
+    if ( pp_kept            == (void *) 0 ) goto no_mem;
+    if ( p_hashes           == (void *) 0 ) goto no_mem;
+    if ( p_table            == (void *) 0 ) goto no_mem;
+    if ( _report.pp_removed == (void *) 0 ) goto no_mem;
+
+    // Initialize memory
+    memset(p_states, 0, node_quantity + 1);
+    memset(pp_kept, 0, ( node_quantity + 1 ) * sizeof(node *));
+    memset(p_table, 0xff, table_mask * sizeof(size_t));
+    table_mask--;
+
+    // Mark the requested sinks
+    for (size_t i = 0; i < sink_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = (void *) 0;
+
+        // Find the sink
+        p_sink = pp_sinks[i];
+        if ( node_graph_node_get(p_node_graph, p_sink, &p_node) == 0 ) goto unknown_sink;
+
+        // Mark the sink
+        p_states[p_node->index] |= NODE_OPTIMIZE_STATE_SINK;
+    }
+
+    // Without requested sinks, each node with no outputs is a sink
+    if ( sink_quantity == 0 )
+        for (size_t v = 0; v < node_quantity; v++)
+            if ( p_node_graph->_p_nodes[v]->out_quantity == 0 ) p_states[v] |= NODE_OPTIMIZE_STATE_SINK;
+
+    // Dead node elimination. In reverse schedule order, each node is
+    // visited after every node it feeds, so one pass marks what is live
+    for (size_t i = p_schedule->entry_quantity; i-- > 0;)
+    {
+
+        // Initialized data
+        const node *p_node = p_schedule->p_entries[i].p_node;
+        unsigned char *p_state = &p_states[p_node->index];
+
+        // Sinks are live, and so is everything, without the pass
+        if ( ( *p_state & NODE_OPTIMIZE_STATE_SINK ) || ( passes & NODE_OPTIMIZE_DEAD ) == 0 ) *p_state |= NODE_OPTIMIZE_STATE_LIVE;
+
+        // Skip dead nodes
+        if ( ( *p_state & NODE_OPTIMIZE_STATE_LIVE ) == 0 ) continue;
+
+        // What a live node reads from is live
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            if ( p_node->in[k].p_in ) p_states[p_node->in[k].p_in->index] |= NODE_OPTIMIZE_STATE_LIVE;
+    }
+
+    // Find identical nodes. In schedule order, the inputs of each node
+    // are already merged, so identical nodes read from the same outputs.
+    // Nothing is rewired yet; inputs are read through the merged nodes
+    for (size_t i = 0; i < p_schedule->entry_quantity && ( passes & NODE_OPTIMIZE_MERGE ); i++)
+    {
+
+        // Initialized data
+        node *p_node = p_schedule->p_entries[i].p_node;
+        size_t slot = 0;
+        hash64 h = 0;
+
+        // Skip dead nodes
+        if ( ( p_states[p_node->index] & NODE_OPTIMIZE_STATE_LIVE ) == 0 ) continue;
+
+        // Skip sinks, and nodes the caller feeds
+        if ( p_states[p_node->index] & NODE_OPTIMIZE_STATE_SINK ) continue;
+        if ( node_optimize_mergeable(p_node) == false ) continue;
+
+        // Hash the node
+        h = node_optimize_hash((const node *const *) pp_kept, p_node);
+
+        // Look for an identical node
+        for (slot = (size_t) h & table_mask; p_table[slot] != SIZE_MAX; slot = ( slot + 1 ) & table_mask)
+        {
+
+            // Initialized data
+            node *p_other = p_node_graph->_p_nodes[p_table[slot]];
+
+            // Skip different nodes
+            if ( p_hashes[p_other->index] != h || node_optimize_equal((const node *const *) pp_kept, p_node, p_other) == false ) continue;
+
+            // Merge the node into the other
+            pp_kept[p_node->index] = p_other;
+            p_states[p_node->index] |= NODE_OPTIMIZE_STATE_MERGED;
+            _report.merged_quantity++;
+
+            // Done
+            break;
+        }
+
+        // Keep distinct nodes
+        if ( p_table[slot] == SIZE_MAX ) p_table[slot] = p_node->index, p_hashes[p_node->index] = h;
+    }
+
+    // Collect the names of the dead nodes, then of the merged nodes.
+    // Removing a node moves another into its index, and may release it,
+    // so the names kept are the interned ones
+    for (size_t v = 0; v < node_quantity; v++)
+        if ( ( p_states[v] & NODE_OPTIMIZE_STATE_LIVE ) == 0 )
+            _report.pp_removed[_report.removed_quantity++] = p_node_graph->symbols.p_symbols[p_node_graph->_p_nodes[v]->id].p_text,
+            _report.dead_quantity++;
+    for (size_t v = 0; v < node_quantity; v++)
+        if ( p_states[v] & NODE_OPTIMIZE_STATE_MERGED )
+            _report.pp_removed[_report.removed_quantity++] = p_node_graph->symbols.p_symbols[p_node_graph->_p_nodes[v]->id].p_text;
+
+    // Mark each live node that reads a merged node. A failure here 
+    // leaves the graph as it was, with some nodes to run again
+    for (size_t v = 0; v < node_quantity && _report.merged_quantity; v++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        // Skip dead and merged nodes
+        if ( ( p_states[v] & NODE_OPTIMIZE_STATE_LIVE ) == 0 || ( p_states[v] & NODE_OPTIMIZE_STATE_MERGED ) ) continue;
+
+        // What the node reads is out of date
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+            if ( p_node->in[k].p_in && pp_kept[p_node->in[k].p_in->index] )
+                if ( node_graph_dirty_mark(p_node_graph, p_node) == 0 ) goto failed_to_mark;
+    }
+
+    // Move each input that reads a merged node onto the node it was merged into
+    for (size_t v = 0; v < node_quantity && _report.merged_quantity; v++)
+    {
+
+        // Initialized data
+        node *p_node = p_node_graph->_p_nodes[v];
+
+        // Skip dead and merged nodes
+        if ( ( p_states[v] & NODE_OPTIMIZE_STATE_LIVE ) == 0 || ( p_states[v] & NODE_OPTIMIZE_STATE_MERGED ) ) continue;
+
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            node *p_in = p_node->in[k].p_in;
+
+            // Skip inputs that read kept nodes
+            if ( p_in == (void *) 0 || pp_kept[p_in->index] == (void *) 0 ) continue;
+
+            // Read the kept node. The edges are rebuilt from the ports
+            p_node->in[k].p_in  = pp_kept[p_in->index],
+            p_node->in[k].value = (void *) 0;
+            p_node_graph->edges.valid = false;
+        }
+    }
+
+    // Remove the nodes
+    for (size_t i = 0; i < _report.removed_quantity; i++)
+        if ( node_graph_remove_node(p_node_graph, _report.pp_removed[i]) == 0 ) goto failed_to_remove;
+
+    // Compile what is left
+    if ( p_node_graph->p_schedule == (void *) 0 )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Store the schedule
+    p_schedule = p_node_graph->p_schedule;
+
+    // Fusion. Compiling emits each chain contiguously, so an entry joins
+    // the unit before it when it is the only successor of the entry
+    // before, and that entry is its only predecessor
+    for (size_t i = 0, head = 0; i < p_schedule->entry_quantity && ( passes & NODE_OPTIMIZE_FUSE ); i++)
+    {
+
+        // Initialized data
+        const node_schedule_entry *p_previous = ( i ) ? &p_schedule->p_entries[i - 1] : (void *) 0;
+
+        // Start a new unit
+        p_schedule->p_entries[i].fused_quantity = 0;
+
+        // Skip entries that do not continue a chain
+        if ( p_previous == (void *) 0                                     ||
+             p_previous->successor_quantity != 1                          ||
+             p_schedule->p_successors[p_previous->successor_offset] != i  ||
+             p_schedule->p_entries[i].predecessor_quantity != 1 ) { head = i; continue; }
+
+        // Fuse the entry into the unit of the chain
+        if ( p_schedule->p_entries[head].fused_quantity++ == 0 ) _report.chain_quantity++;
+        _report.fused_quantity++;
+    }
+
+    // Release memory
+    p_states = NODE_REALLOC(p_states, 0),
+    pp_kept  = NODE_REALLOC(pp_kept, 0),
+    p_hashes = NODE_REALLOC(p_hashes, 0),
+    p_table  = NODE_REALLOC(p_table, 0);
+
+    // Return the report, or release it
+    if ( p_report ) *p_report = _report;
+    else            node_optimize_report_release(&_report);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [optimize] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_sinks:
+                #ifndef NDEBUG
+                    log_error("[node] [optimize] Null pointer provided for parameter \"pp_sinks\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Node errors
+        {
+            unknown_sink:
+                #ifndef NDEBUG
+                    log_error("[node] [optimize] Sink \"%s\" is not in the graph in call to function \"%s\"\n", p_sink, __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+
+            failed_to_mark:
+                #ifndef NDEBUG
+                    log_error("[node] [optimize] Failed to mark node dirty in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+        }
+
+        // Graph errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] [optimize] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+
+            failed_to_remove:
+                #ifndef NDEBUG
+                    log_error("[node] [optimize] Failed to remove node in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                goto release;
+        }
+
+        // Release memory
+        release:
+            if ( p_states ) p_states = NODE_REALLOC(p_states, 0);
+            if ( pp_kept  ) pp_kept  = NODE_REALLOC(pp_kept, 0);
+            if ( p_hashes ) p_hashes = NODE_REALLOC(p_hashes, 0);
+            if ( p_table  ) p_table  = NODE_REALLOC(p_table, 0);
+            node_optimize_report_release(&_report);
+
+            // Error
+            return 0;
+    }
+}
+
+void node_optimize_report_release ( node_optimize_report *const p_report )
+{
+
+    // Argument check
+    if ( p_report == (void *) 0 ) return;
+
+    // Release the names
+    if ( p_report->pp_removed ) p_report->pp_removed = NODE_REALLOC(p_report->pp_removed, 0);
+
+    // Clear the report
+    *p_report = (node_optimize_report) { 0 };
+}
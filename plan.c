@@ -0,0 +1,404 @@
+/** !
+ * Lifetime planning of node output buffers
+ *
+ * @file plan.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/plan.h>
+
+// Preprocessor definitions
+#define NODE_PLAN_ALIGN(x) ( ( (x) + NODE_PLAN_ALIGNMENT - 1 ) & ~ (size_t) ( NODE_PLAN_ALIGNMENT - 1 ) )
+
+// An output is planned if it has a size, and its type fits the alignment of the arena
+#define NODE_PLAN_PLANNED(o) ( (o).size && ( (o).p_type == (void *) 0 || (o).p_type->alignment <= NODE_PLAN_ALIGNMENT ) )
+
+// Function definitions
+size_t node_plan_allocate ( size_t *const p_offsets, size_t *const p_sizes, size_t *const p_quantity, size_t *const p_top, size_t size )
+{
+
+    // Initialized data
+    size_t best   = SIZE_MAX,
+           offset = 0;
+
+    // Find the smallest free block that fits
+    for (size_t f = 0; f < *p_quantity; f++)
+        if ( p_sizes[f] >= size && ( best == SIZE_MAX || p_sizes[f] < p_sizes[best] ) ) best = f;
+
+    // Take the front of the block
+    if ( best != SIZE_MAX )
+    {
+
+        // Store the offset
+        offset = p_offsets[best];
+
+        // Shrink the block
+        p_offsets[best] += size,
+        p_sizes[best]   -= size;
+
+        // Remove the block, once empty
+        if ( p_sizes[best] == 0 )
+        {
+            memmove(&p_offsets[best], &p_offsets[best + 1], ( *p_quantity - best - 1 ) * sizeof(size_t)),
+            memmove(&p_sizes[best],   &p_sizes[best + 1],   ( *p_quantity - best - 1 ) * sizeof(size_t));
+            (*p_quantity)--;
+        }
+
+        // Done
+        return offset;
+    }
+
+    // Grow the arena. A free block at the top grows into the buffer
+    if ( *p_quantity && p_offsets[*p_quantity - 1] + p_sizes[*p_quantity - 1] == *p_top )
+        *p_top = p_offsets[--(*p_quantity)];
+
+    // Store the offset
+    offset = *p_top;
+
+    // Grow
+    *p_top += size;
+
+    // Done
+    return offset;
+}
+
+void node_plan_free ( size_t *const p_offsets, size_t *const p_sizes, size_t *const p_quantity, size_t offset, size_t size )
+{
+
+    // Initialized data
+    size_t f = 0;
+
+    // Find the first block after the buffer. The blocks are sorted by offset
+    while ( f < *p_quantity && p_offsets[f] < offset ) f++;
+
+    // Join the block before
+    if ( f && p_offsets[f - 1] + p_sizes[f - 1] == offset )
+    {
+
+        // Grow the block before
+        p_sizes[f - 1] += size;
+
+        // Join the block after, too
+        if ( f < *p_quantity && offset + size == p_offsets[f] )
+        {
+            p_sizes[f - 1] += p_sizes[f];
+            memmove(&p_offsets[f], &p_offsets[f + 1], ( *p_quantity - f - 1 ) * sizeof(size_t)),
+            memmove(&p_sizes[f],   &p_sizes[f + 1],   ( *p_quantity - f - 1 ) * sizeof(size_t));
+            (*p_quantity)--;
+        }
+
+        // Done
+        return;
+    }
+
+    // Join the block after
+    if ( f < *p_quantity && offset + size == p_offsets[f] )
+    {
+        p_offsets[f] = offset,
+        p_sizes[f]  += size;
+
+        // Done
+        return;
+    }
+
+    // Insert a new block
+    memmove(&p_offsets[f + 1], &p_offsets[f], ( *p_quantity - f ) * sizeof(size_t)),
+    memmove(&p_sizes[f + 1],   &p_sizes[f],   ( *p_quantity - f ) * sizeof(size_t));
+    p_offsets[f] = offset,
+    p_sizes[f]   = size;
+    (*p_quantity)++;
+
+    // Done
+    return;
+}
+
+int node_graph_plan ( node_graph *const p_node_graph, const node_plan **const pp_plan )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Initialized data
+    const node_schedule *p_schedule = (void *) 0;
+    node_plan *p_plan = (void *) 0;
+    size_t node_quantity   = 0,
+           entry_quantity  = 0,
+           output_quantity = 0,
+           buffer_quantity = 0,
+           free_quantity   = 0,
+           top             = 0;
+    size_t *p_starts       = (void *) 0,
+           *p_slots        = (void *) 0,
+           *p_heads        = (void *) 0,
+           *p_next         = (void *) 0,
+           *p_free_offsets = (void *) 0,
+           *p_free_sizes   = (void *) 0;
+
+    // Compile the node graph on first use
+    if ( p_node_graph->p_schedule == (void *) 0 )
+        if ( node_graph_compile(p_node_graph) == 0 ) goto failed_to_compile;
+
+    // Drop the previous plan
+    node_graph_plan_release(p_node_graph);
+
+    // Store the schedule and the size of the graph
+    p_schedule     = p_node_graph->p_schedule,
+    node_quantity  = p_node_graph->node_quantity,
+    entry_quantity = p_schedule->entry_quantity;
+
+    // Allocate memory
+    p_starts = NODE_REALLOC(0, ( node_quantity + 1 ) * sizeof(size_t)),
+    p_heads  = NODE_REALLOC(0, ( entry_quantity + 1 ) * sizeof(size_t));
+
+    // Error check
+    if ( p_starts == (void *) 0 ) goto no_mem;
+    if ( p_heads  == (void *) 0 ) goto no_mem;
+
+    // Number the outputs of each node, and count the outputs with a size
+    for (size_t v = 0; v < node_quantity; v++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[v];
+
+        // Store the first output of the node
+        p_starts[v] = output_quantity;
+
+        // Accumulate
+        output_quantity += p_node->out_quantity;
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+            if ( NODE_PLAN_PLANNED(p_node->out[j]) ) buffer_quantity++;
+    }
+
+    // Allocate memory
+    p_plan         = NODE_REALLOC(0, sizeof(node_plan) + buffer_quantity * sizeof(node_plan_buffer)),
+    p_slots        = NODE_REALLOC(0, ( output_quantity + 1 ) * sizeof(size_t)),
+    p_next         = NODE_REALLOC(0, ( buffer_quantity + 1 ) * sizeof(size_t)),
+    p_free_offsets = NODE_REALLOC(0, ( buffer_quantity + 1 ) * sizeof(size_t)),
+    p_free_sizes   = NODE_REALLOC(0, ( buffer_quantity + 1 ) * sizeof(size_t));
+
+    // Error check
+    if ( p_plan         == (void *) 0 ) goto no_mem;
+    if ( p_slots        == (void *) 0 ) goto no_mem;
+    if ( p_next         == (void *) 0 ) goto no_mem;
+    if ( p_free_offsets == (void *) 0 ) goto no_mem;
+    if ( p_free_sizes   == (void *) 0 ) goto no_mem;
+
+    // Initialize the plan
+    *p_plan = (node_plan) { .buffer_quantity = buffer_quantity };
+
+    // Make a buffer for each output with a size, in schedule order
+    for (size_t i = 0, b = 0; i < entry_quantity; i++)
+    {
+
+        // Initialized data
+        node *p_node = p_schedule->p_entries[i].p_node;
+
+        // Each output
+        for (size_t j = 0; j < p_node->out_quantity; j++)
+        {
+
+            // Initialized data
+            size_t slot = p_starts[p_node->index] + j;
+
+            // Skip outputs that are not planned
+            if ( NODE_PLAN_PLANNED(p_node->out[j]) == 0 ) { p_slots[slot] = SIZE_MAX; continue; }
+
+            // Store the buffer. Until a reader is found, it is unread
+            p_plan->_buffers[b] = (node_plan_buffer)
+            {
+                .p_node    = p_node,
+                .out_index = j,
+                .first     = i,
+                .last      = SIZE_MAX,
+                .offset    = 0,
+                .size      = p_node->out[j].size,
+                .p_previous = (void *) 0
+            };
+            p_slots[slot] = b++;
+
+            // Accumulate
+            p_plan->unaliased_size += NODE_PLAN_ALIGN(p_node->out[j].size);
+        }
+    }
+
+    // Extend each buffer through its last reader
+    for (size_t i = 0; i < entry_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_schedule->p_entries[i].p_node;
+
+        // Each input
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            const node *p_in = p_node->in[k].p_in;
+            size_t b = ( p_in ) ? p_slots[p_starts[p_in->index] + p_node->in[k].out_index] : SIZE_MAX;
+
+            // Skip inputs that do not read a buffer
+            if ( b == SIZE_MAX ) continue;
+
+            // Extend the buffer
+            if ( p_plan->_buffers[b].last == SIZE_MAX || p_plan->_buffers[b].last < i ) p_plan->_buffers[b].last = i;
+        }
+    }
+
+    // Keep each unread buffer to the end, then list the buffers by the
+    // position that last reads them
+    memset(p_heads, 0xff, ( entry_quantity + 1 ) * sizeof(size_t));
+    for (size_t b = 0; b < buffer_quantity; b++)
+    {
+
+        // Initialized data
+        node_plan_buffer *p_buffer = &p_plan->_buffers[b];
+
+        // Unread buffers are live after the run
+        if ( p_buffer->last == SIZE_MAX ) p_buffer->last = entry_quantity;
+
+        // Push the buffer
+        p_next[b] = p_heads[p_buffer->last],
+        p_heads[p_buffer->last] = b;
+    }
+
+    // Walk the schedule. Buffers are freed once their last reader has
+    // run, and an output takes the smallest free block it fits. Buffers
+    // last read by an entry are not free while it makes its outputs
+    for (size_t i = 0, b = 0; i < entry_quantity; i++)
+    {
+
+        // Free the buffers the entry before read last
+        if ( i )
+            for (size_t f = p_heads[i - 1]; f != SIZE_MAX; f = p_next[f])
+                node_plan_free(p_free_offsets, p_free_sizes, &free_quantity, p_plan->_buffers[f].offset, NODE_PLAN_ALIGN(p_plan->_buffers[f].size));
+
+        // Place the outputs of the entry
+        for (; b < buffer_quantity && p_plan->_buffers[b].first == i; b++)
+            p_plan->_buffers[b].offset = node_plan_allocate(p_free_offsets, p_free_sizes, &free_quantity, &top, NODE_PLAN_ALIGN(p_plan->_buffers[b].size));
+    }
+
+    // Allocate the arena, with room to align it
+    p_plan->arena_size = top;
+    if ( top )
+    {
+
+        // Allocate the block
+        p_plan->_p_block = NODE_REALLOC(0, top + NODE_PLAN_ALIGNMENT);
+
+        // Error check
+        if ( p_plan->_p_block == (void *) 0 ) goto no_mem;
+
+        // Align the arena
+        p_plan->p_arena = (void *) NODE_PLAN_ALIGN((uintptr_t) p_plan->_p_block);
+    }
+
+    // Point each output at its buffer, and remember where it pointed before
+    for (size_t b = 0; b < buffer_quantity; b++)
+    {
+
+        // Initialized data
+        node_output *p_output = &p_plan->_buffers[b].p_node->out[p_plan->_buffers[b].out_index];
+
+        // Store the buffer
+        p_plan->_buffers[b].p_previous = p_output->value,
+        p_output->value = (unsigned char *) p_plan->p_arena + p_plan->_buffers[b].offset;
+    }
+
+    // Store the plan
+    p_node_graph->p_plan = p_plan;
+
+    // Release memory
+    p_starts       = NODE_REALLOC(p_starts, 0),
+    p_slots        = NODE_REALLOC(p_slots, 0),
+    p_heads        = NODE_REALLOC(p_heads, 0),
+    p_next         = NODE_REALLOC(p_next, 0),
+    p_free_offsets = NODE_REALLOC(p_free_offsets, 0),
+    p_free_sizes   = NODE_REALLOC(p_free_sizes, 0);
+
+    // Return a pointer to the caller
+    if ( pp_plan ) *pp_plan = p_plan;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [plan] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_compile:
+                #ifndef NDEBUG
+                    log_error("[node] [plan] Failed to compile node graph in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release memory
+                if ( p_plan         ) p_plan         = NODE_REALLOC(p_plan, 0);
+                if ( p_starts       ) p_starts       = NODE_REALLOC(p_starts, 0);
+                if ( p_slots        ) p_slots        = NODE_REALLOC(p_slots, 0);
+                if ( p_heads        ) p_heads        = NODE_REALLOC(p_heads, 0);
+                if ( p_next         ) p_next         = NODE_REALLOC(p_next, 0);
+                if ( p_free_offsets ) p_free_offsets = NODE_REALLOC(p_free_offsets, 0);
+                if ( p_free_sizes   ) p_free_sizes   = NODE_REALLOC(p_free_sizes, 0);
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_graph_plan_release ( node_graph *const p_node_graph )
+{
+
+    // Initialized data
+    node_plan *p_plan = ( p_node_graph ) ? p_node_graph->p_plan : (void *) 0;
+
+    // Fast exit
+    if ( p_plan == (void *) 0 ) return;
+
+    // Restore each output that still points at its buffer
+    for (size_t b = 0; b < p_plan->buffer_quantity; b++)
+    {
+
+        // Initialized data
+        node_output *p_output = &p_plan->_buffers[b].p_node->out[p_plan->_buffers[b].out_index];
+
+        // Error check
+        if ( p_output->value != (unsigned char *) p_plan->p_arena + p_plan->_buffers[b].offset ) continue;
+
+        // Restore the output. A typed output goes back to its slot, with the value of the last run
+        if ( p_output->p_type && p_plan->_buffers[b].p_previous )
+            memcpy(p_plan->_buffers[b].p_previous, p_output->value, p_output->p_type->size);
+        p_output->value = p_plan->_buffers[b].p_previous;
+    }
+
+    // Release the arena
+    if ( p_plan->_p_block ) p_plan->_p_block = NODE_REALLOC(p_plan->_p_block, 0);
+
+    // Release the plan
+    p_node_graph->p_plan = NODE_REALLOC(p_plan, 0);
+}
@@ -0,0 +1,711 @@
+/** !
+ * Versioned snapshots of node graphs, reclaimed by epoch
+ *
+ * @file snapshot.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/snapshot.h>
+
+// Preprocessor definitions
+#define NODE_SNAPSHOT_ALIGN(x) ( ( (x) + NODE_SNAPSHOT_LINE_SIZE - 1 ) & ~ (size_t) ( NODE_SNAPSHOT_LINE_SIZE - 1 ) )
+
+// Function definitions
+int node_snapshot_domain_create ( node_graph *const p_node_graph )
+{
+
+    // Initialized data
+    void *p_block = NODE_REALLOC(0, sizeof(node_snapshot_domain) + NODE_SNAPSHOT_LINE_SIZE);
+    node_snapshot_domain *p_domain = (void *) 0;
+
+    // Error check
+    if ( p_block == (void *) 0 ) goto no_mem;
+
+    // Place the domain on a line of its own
+    p_domain = (node_snapshot_domain *) NODE_SNAPSHOT_ALIGN((uintptr_t) p_block);
+
+    // Initialize memory
+    memset(p_domain, 0, sizeof(node_snapshot_domain));
+    p_domain->_p_block = p_block;
+
+    // Epoch 0 marks a reader that is outside of a snapshot, so epochs count from 1
+    atomic_init(&p_domain->p_current, (void *) 0);
+    atomic_init(&p_domain->epoch, 1);
+
+    // Each reader is free, and outside of a snapshot
+    for (size_t i = 0; i < NODE_SNAPSHOT_READER_QUANTITY; i++)
+        atomic_init(&p_domain->_readers[i].epoch, 0),
+        atomic_init(&p_domain->_readers[i].used, false),
+        p_domain->_readers[i].p_domain = p_domain;
+
+    // Store the domain
+    p_node_graph->p_snapshots = p_domain;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_snapshot_build ( const node_graph *const p_node_graph, node_snapshot **const pp_snapshot )
+{
+
+    // Initialized data
+    size_t node_quantity = p_node_graph->node_quantity,
+           in_quantity = 0,
+           successor_quantity = 0,
+           slot_quantity = 2,
+           size = 0;
+    node_snapshot *p_snapshot = (void *) 0;
+    node_snapshot_node *p_nodes = (void *) 0;
+    node_snapshot_link *p_links = (void *) 0,
+                       *p_in = (void *) 0,
+                       *p_out = (void *) 0;
+    size_t *p_slots = (void *) 0;
+
+    // Count the inputs, and the connected ones, each of which is a successor of its output
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+
+        // Count the inputs
+        in_quantity += p_node->in_quantity;
+
+        // Count the connections
+        for (size_t k = 0; k < p_node->in_quantity; k++) successor_quantity += ( p_node->in[k].p_in != (void *) 0 );
+    }
+
+    // Keep the load factor of the name table at or under one half
+    while ( slot_quantity < node_quantity * 2 ) slot_quantity *= 2;
+
+    // The snapshot, its nodes, its links and its name table are one allocation
+    size = sizeof(node_snapshot)
+         + node_quantity * sizeof(node_snapshot_node)
+         + ( in_quantity + successor_quantity ) * sizeof(node_snapshot_link)
+         + slot_quantity * sizeof(size_t);
+
+    // Allocate the snapshot
+    p_snapshot = NODE_REALLOC(0, size);
+
+    // Error check
+    if ( p_snapshot == (void *) 0 ) goto no_mem;
+
+    // Lay out the allocation
+    p_nodes = (node_snapshot_node *) ( p_snapshot + 1 ),
+    p_links = (node_snapshot_link *) ( p_nodes + node_quantity ),
+    p_slots = (size_t *) ( p_links + in_quantity + successor_quantity );
+
+    // Initialize memory
+    memset(p_slots, 0, slot_quantity * sizeof(size_t));
+
+    // Copy each node, and make room for its inputs
+    p_in = p_links;
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+
+        // Copy the node
+        p_nodes[i] = (node_snapshot_node)
+        {
+            .p_node             = p_node,
+            .p_name             = p_node->p_name,
+            .index              = i,
+            .in_quantity        = p_node->in_quantity,
+            .out_quantity       = p_node->out_quantity,
+            .successor_quantity = 0,
+            .in                 = p_in
+        };
+
+        // Make room for its inputs
+        p_in += p_node->in_quantity;
+    }
+
+    // Count the successors of each node
+    for (size_t i = 0; i < node_quantity; i++)
+        for (size_t k = 0; k < p_node_graph->_p_nodes[i]->in_quantity; k++)
+            if ( p_node_graph->_p_nodes[i]->in[k].p_in ) p_nodes[p_node_graph->_p_nodes[i]->in[k].p_in->index].successor_quantity++;
+
+    // Give each node a run of successor links
+    p_out = p_in;
+    for (size_t i = 0; i < node_quantity; i++)
+        p_nodes[i].out = p_out,
+        p_out += p_nodes[i].successor_quantity,
+        p_nodes[i].successor_quantity = 0;
+
+    // Link each input to the output that feeds it, and back
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        const node *p_node = p_node_graph->_p_nodes[i];
+        node_snapshot_link *p_node_in = (node_snapshot_link *) p_nodes[i].in;
+
+        // Link each input
+        for (size_t k = 0; k < p_node->in_quantity; k++)
+        {
+
+            // Initialized data
+            const node *p_feed = p_node->in[k].p_in;
+            node_snapshot_node *p_from = ( p_feed ) ? &p_nodes[p_feed->index] : (void *) 0;
+
+            // Link the input
+            p_node_in[k] = (node_snapshot_link)
+            {
+                .p_node    = p_from,
+                .out_index = p_node->in[k].out_index,
+                .in_index  = k
+            };
+
+            // Unconnected
+            if ( p_from == (void *) 0 ) continue;
+
+            // Link the output back
+            ( (node_snapshot_link *) p_from->out )[p_from->successor_quantity++] = (node_snapshot_link)
+            {
+                .p_node    = &p_nodes[i],
+                .out_index = p_node->in[k].out_index,
+                .in_index  = k
+            };
+        }
+    }
+
+    // Index each node by the hash of its name, which its symbol already holds
+    for (size_t i = 0; i < node_quantity; i++)
+    {
+
+        // Initialized data
+        size_t mask = slot_quantity - 1,
+               s = p_node_graph->symbols.p_symbols[p_nodes[i].p_node->id].hash & mask;
+
+        // Find an empty slot
+        while ( p_slots[s] ) s = ( s + 1 ) & mask;
+
+        // Store the index. Slots hold index + 1, so 0 is empty
+        p_slots[s] = i + 1;
+    }
+
+    // Populate the snapshot
+    *p_snapshot = (node_snapshot)
+    {
+        .version       = 0,
+        .node_quantity = node_quantity,
+        .link_quantity = in_quantity + successor_quantity,
+        .p_nodes       = p_nodes,
+        .slot_mask     = slot_quantity - 1,
+        .p_slots       = p_slots,
+        .retired       = 0,
+        .p_next        = (void *) 0
+    };
+
+    // Return a pointer to the caller
+    *pp_snapshot = p_snapshot;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_graph_snapshot_reserve ( node_graph *const p_node_graph )
+{
+
+    // Initialized data
+    node_snapshot_domain *p_domain = p_node_graph->p_snapshots;
+    node_snapshot_retired *p_retired_nodes = (void *) 0;
+    size_t capacity = 0;
+
+    // A graph without snapshots releases its nodes at once
+    if ( p_domain == (void *) 0 ) return 1;
+
+    // Fast exit
+    if ( p_domain->retired_node_quantity < p_domain->retired_node_capacity ) return 1;
+
+    // Grow the retired nodes
+    capacity        = ( p_domain->retired_node_capacity ) ? p_domain->retired_node_capacity * 2 : 16,
+    p_retired_nodes = NODE_REALLOC(p_domain->p_retired_nodes, capacity * sizeof(node_snapshot_retired));
+
+    // Error check
+    if ( p_retired_nodes == (void *) 0 ) goto no_mem;
+
+    // Store the retired nodes
+    p_domain->p_retired_nodes       = p_retired_nodes,
+    p_domain->retired_node_capacity = capacity;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_graph_snapshot_retire ( node_graph *const p_node_graph, node *p_node )
+{
+
+    // Initialized data
+    node_snapshot_domain *p_domain = p_node_graph->p_snapshots;
+
+    // A node in the arena of its graph is released with the graph
+    if ( p_node->owns_memory == false ) return;
+
+    // No snapshot can point to the node
+    if ( p_domain == (void *) 0 ) { p_node = NODE_REALLOC(p_node, 0); return; }
+
+    // The current snapshot may point to the node. Once a later publish
+    // moves the epoch on, it is retired in this epoch too
+    p_domain->p_retired_nodes[p_domain->retired_node_quantity++] = (node_snapshot_retired)
+    {
+        .p_node  = p_node,
+        .retired = atomic_load(&p_domain->epoch)
+    };
+
+    // Done
+    return;
+}
+
+size_t node_graph_snapshot_reclaim ( node_graph *const p_node_graph )
+{
+
+    // Initialized data
+    node_snapshot_domain *p_domain = ( p_node_graph ) ? p_node_graph->p_snapshots : (void *) 0;
+    node_snapshot **pp_snapshot = (void *) 0;
+    size_t oldest = 0;
+
+    // Fast exit
+    if ( p_domain == (void *) 0 ) return 0;
+
+    // Nothing retired in the current epoch can be released yet
+    oldest = atomic_load(&p_domain->epoch);
+
+    // Find the oldest epoch a reader is in
+    for (size_t i = 0; i < NODE_SNAPSHOT_READER_QUANTITY; i++)
+    {
+
+        // Initialized data
+        size_t epoch = atomic_load(&p_domain->_readers[i].epoch);
+
+        // Readers outside of a snapshot hold nothing
+        if ( epoch && epoch < oldest ) oldest = epoch;
+    }
+
+    // A snapshot replaced in an epoch before the oldest reader entered can not be held
+    for (pp_snapshot = &p_domain->p_retired; *pp_snapshot;)
+    {
+
+        // Initialized data
+        node_snapshot *p_snapshot = *pp_snapshot;
+
+        // Still held, perhaps
+        if ( p_snapshot->retired >= oldest ) { pp_snapshot = &p_snapshot->p_next; continue; }
+
+        // Unlink the snapshot, then release it
+        *pp_snapshot = p_snapshot->p_next;
+        p_snapshot = NODE_REALLOC(p_snapshot, 0);
+        p_domain->retired_quantity--;
+    }
+
+    // Likewise, a node removed in such an epoch is in no snapshot that is left
+    for (size_t i = 0; i < p_domain->retired_node_quantity;)
+    {
+
+        // Initialized data
+        node_snapshot_retired *p_retired = &p_domain->p_retired_nodes[i];
+
+        // Still held, perhaps
+        if ( p_retired->retired >= oldest ) { i++; continue; }
+
+        // Release the node, then fill its place with the last one
+        p_retired->p_node = NODE_REALLOC(p_retired->p_node, 0);
+        *p_retired = p_domain->p_retired_nodes[--p_domain->retired_node_quantity];
+    }
+
+    // Done
+    return p_domain->retired_quantity;
+}
+
+int node_graph_snapshot_publish ( node_graph *const p_node_graph, const node_snapshot **const pp_snapshot )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+
+    // Initialized data
+    node_snapshot_domain *p_domain = (void *) 0;
+    node_snapshot *p_snapshot = (void *) 0,
+                  *p_replaced = (void *) 0;
+
+    // Make the snapshots of the graph on its first publish
+    if ( p_node_graph->p_snapshots == (void *) 0 )
+        if ( node_snapshot_domain_create(p_node_graph) == 0 ) goto failed_to_create_domain;
+
+    // Store the domain
+    p_domain = p_node_graph->p_snapshots;
+
+    // Copy the graph
+    if ( node_snapshot_build(p_node_graph, &p_snapshot) == 0 ) goto failed_to_build_snapshot;
+
+    // Number the snapshot
+    p_snapshot->version = ++p_domain->version;
+
+    // Publish the snapshot. Readers that enter from here on see it
+    p_replaced = atomic_exchange(&p_domain->p_current, p_snapshot);
+
+    // Retire the snapshot it replaced in the current epoch, then move the epoch on
+    if ( p_replaced )
+        p_replaced->retired = atomic_fetch_add(&p_domain->epoch, 1),
+        p_replaced->p_next = p_domain->p_retired,
+        p_domain->p_retired = p_replaced,
+        p_domain->retired_quantity++;
+
+    // Release what no reader holds
+    node_graph_snapshot_reclaim(p_node_graph);
+
+    // Return a pointer to the caller
+    if ( pp_snapshot ) *pp_snapshot = p_snapshot;
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            failed_to_create_domain:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Failed to create snapshots in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            failed_to_build_snapshot:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Failed to build snapshot in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_snapshot_reader_register ( node_graph *const p_node_graph, node_snapshot_reader **const pp_reader )
+{
+
+    // Argument check
+    if ( p_node_graph == (void *) 0 ) goto no_node_graph;
+    if ( pp_reader    == (void *) 0 ) goto no_reader;
+
+    // Initialized data
+    node_snapshot_domain *p_domain = p_node_graph->p_snapshots;
+
+    // State check
+    if ( p_domain == (void *) 0 ) goto never_published;
+
+    // Claim the first free reader
+    for (size_t i = 0; i < NODE_SNAPSHOT_READER_QUANTITY; i++)
+    {
+
+        // Initialized data
+        bool unused = false;
+
+        // Taken
+        if ( atomic_compare_exchange_strong(&p_domain->_readers[i].used, &unused, true) == false ) continue;
+
+        // Return a pointer to the caller
+        *pp_reader = &p_domain->_readers[i];
+
+        // Success
+        return 1;
+    }
+
+    // Every reader is taken
+    goto no_free_reader;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_node_graph:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"p_node_graph\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_reader:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"pp_reader\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Graph errors
+        {
+            never_published:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Graph has not published a snapshot in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_free_reader:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] All %d readers are registered in call to function \"%s\"\n", NODE_SNAPSHOT_READER_QUANTITY, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_snapshot_reader_unregister ( node_snapshot_reader **const pp_reader )
+{
+
+    // Argument check
+    if ( pp_reader  == (void *) 0 ) goto no_reader;
+    if ( *pp_reader == (void *) 0 ) goto no_reader;
+
+    // Initialized data
+    node_snapshot_reader *p_reader = *pp_reader;
+
+    // No more pointer for caller
+    *pp_reader = (void *) 0;
+
+    // Leave any snapshot, then free the reader
+    atomic_store(&p_reader->epoch, 0);
+    atomic_store(&p_reader->used, false);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_reader:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"pp_reader\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_snapshot_enter ( node_snapshot_reader *const p_reader, const node_snapshot **const pp_snapshot )
+{
+
+    // Argument check
+    if ( p_reader    == (void *) 0 ) goto no_reader;
+    if ( pp_snapshot == (void *) 0 ) goto no_snapshot;
+
+    // Initialized data
+    node_snapshot_domain *p_domain = p_reader->p_domain;
+
+    // Announce the epoch, before loading the snapshot. A snapshot the
+    // writer replaces after the load is retired in this epoch or a
+    // later one, and is kept until the reader exits
+    atomic_store(&p_reader->epoch, atomic_load(&p_domain->epoch));
+
+    // Return a pointer to the caller
+    *pp_snapshot = atomic_load(&p_domain->p_current);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_reader:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"p_reader\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_snapshot:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"pp_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_snapshot_exit ( node_snapshot_reader *const p_reader )
+{
+
+    // Fast exit
+    if ( p_reader == (void *) 0 ) return;
+
+    // Every read of the snapshot happens before the writer sees the reader leave
+    atomic_store_explicit(&p_reader->epoch, 0, memory_order_release);
+}
+
+int node_snapshot_node_get ( const node_snapshot *const p_snapshot, const char *const p_name, const node_snapshot_node **const pp_node )
+{
+
+    // Argument check
+    if ( p_snapshot == (void *) 0 ) goto no_snapshot;
+    if ( p_name     == (void *) 0 ) goto no_name;
+    if ( pp_node    == (void *) 0 ) goto no_node;
+
+    // Initialized data
+    hash64 hash = hash_fnv64(p_name, strlen(p_name));
+
+    // Probe until the node or an empty slot is found
+    for (size_t s = hash & p_snapshot->slot_mask; p_snapshot->p_slots[s]; s = ( s + 1 ) & p_snapshot->slot_mask)
+    {
+
+        // Initialized data
+        const node_snapshot_node *p_node = &p_snapshot->p_nodes[p_snapshot->p_slots[s] - 1];
+
+        // Compare the name
+        if ( strcmp(p_node->p_name, p_name) ) continue;
+
+        // Return a pointer to the caller
+        *pp_node = p_node;
+
+        // Found
+        return 1;
+    }
+
+    // Not found
+    return 0;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_snapshot:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"p_snapshot\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"p_name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_node:
+                #ifndef NDEBUG
+                    log_error("[node] [snapshot] Null pointer provided for parameter \"pp_node\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+void node_graph_snapshot_release ( node_graph *const p_node_graph )
+{
+
+    // Initialized data
+    node_snapshot_domain *p_domain = ( p_node_graph ) ? p_node_graph->p_snapshots : (void *) 0;
+    node_snapshot *p_current = (void *) 0;
+
+    // Fast exit
+    if ( p_domain == (void *) 0 ) return;
+
+    // Release each retired snapshot
+    while ( p_domain->p_retired )
+    {
+
+        // Initialized data
+        node_snapshot *p_next = p_domain->p_retired->p_next;
+
+        // Release the snapshot
+        p_domain->p_retired = NODE_REALLOC(p_domain->p_retired, 0);
+        p_domain->p_retired = p_next;
+    }
+
+    // Release each retired node
+    for (size_t i = 0; i < p_domain->retired_node_quantity; i++)
+        p_domain->p_retired_nodes[i].p_node = NODE_REALLOC(p_domain->p_retired_nodes[i].p_node, 0);
+    if ( p_domain->p_retired_nodes ) p_domain->p_retired_nodes = NODE_REALLOC(p_domain->p_retired_nodes, 0);
+
+    // Release the current snapshot
+    p_current = atomic_load(&p_domain->p_current);
+    if ( p_current ) p_current = NODE_REALLOC(p_current, 0);
+
+    // Release the domain
+    p_node_graph->p_snapshots = (void *) 0;
+    p_domain = NODE_REALLOC(p_domain->_p_block, 0);
+}
@@ -0,0 +1,282 @@
+/** !
+ * Tracing of node runs
+ *
+ * @file trace.c
+ *
+ * @author Jacob Smith
+ */
+
+// Header
+#include <node/trace.h>
+
+// Preprocessor definitions
+#define NODE_TRACE_MASK ( (size_t) NODE_TRACE_RING_SIZE - 1 )
+
+// Data
+atomic_bool node_trace_active = false;
+static _Atomic(node_trace_ring *) p_rings = (void *) 0;
+static atomic_size_t ring_quantity = 0;
+static atomic_uint_least64_t epoch = 0;
+static _Thread_local node_trace_ring *p_thread_ring = (void *) 0;
+
+// Function definitions
+uint64_t node_trace_now ( void )
+{
+
+    // Initialized data
+    struct timespec now = { 0 };
+
+    // Read the clock
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    // Done
+    return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+void node_trace_start ( void )
+{
+
+    // Initialized data
+    uint_least64_t none = 0;
+
+    // Times are relative to the first start
+    atomic_compare_exchange_strong(&epoch, &none, node_trace_now());
+
+    // Start recording
+    atomic_store(&node_trace_active, true);
+}
+
+void node_trace_stop ( void )
+{
+
+    // Stop recording
+    atomic_store(&node_trace_active, false);
+}
+
+void node_trace_clear ( void )
+{
+
+    // Empty each ring
+    for (node_trace_ring *p_ring = atomic_load(&p_rings); p_ring; p_ring = p_ring->p_next)
+        atomic_store(&p_ring->head, 0);
+}
+
+int node_trace_record_run ( const node *const p_node, uint64_t begin, uint64_t end )
+{
+
+    // Initialized data
+    node_trace_ring *p_ring = p_thread_ring;
+    size_t head = 0,
+           bytes = 0;
+
+    // Make a ring for this thread on its first record
+    if ( p_ring == (void *) 0 )
+    {
+
+        // Allocate the ring
+        p_ring = NODE_REALLOC(0, sizeof(node_trace_ring));
+
+        // Error check
+        if ( p_ring == (void *) 0 ) goto no_mem;
+
+        // Initialize the ring
+        p_ring->thread = atomic_fetch_add(&ring_quantity, 1) + 1;
+        atomic_init(&p_ring->head, 0);
+
+        // Push it onto the list
+        p_ring->p_next = atomic_load(&p_rings);
+        while ( atomic_compare_exchange_weak(&p_rings, &p_ring->p_next, p_ring) == false );
+
+        // Keep it for this thread
+        p_thread_ring = p_ring;
+    }
+
+    // Count the bytes the node produced
+    for (size_t j = 0; j < p_node->out_quantity; j++) bytes += p_node->out[j].size;
+
+    // Write the record, then publish it
+    head = atomic_load_explicit(&p_ring->head, memory_order_relaxed);
+    p_ring->_records[head & NODE_TRACE_MASK] = (node_trace_record)
+    {
+        .p_name = p_node->p_name,
+        .begin  = begin,
+        .end    = end,
+        .bytes  = bytes
+    };
+    atomic_store_explicit(&p_ring->head, head + 1, memory_order_release);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}
+
+int node_trace_name_write ( FILE *p_f, const char *p_name )
+{
+
+    // Escape the name
+    for (; *p_name; p_name++)
+    {
+
+        // Initialized data
+        unsigned char c = (unsigned char) *p_name;
+
+        // Quotes and backslashes
+        if ( c == '"' || c == '\\' ) { fputc('\\', p_f); fputc(c, p_f); continue; }
+
+        // Control characters
+        if ( c < 0x20 ) { fprintf(p_f, "\\u%04x", c); continue; }
+
+        // Everything else
+        fputc(c, p_f);
+    }
+
+    // Success
+    return 1;
+}
+
+int node_trace_dump ( const char *const p_path )
+{
+
+    // Argument check
+    if ( p_path == (void *) 0 ) goto no_path;
+
+    // Initialized data
+    FILE *p_f = fopen(p_path, "w");
+    node_trace_record *p_records = (void *) 0;
+    uint64_t start = atomic_load(&epoch);
+    size_t event_quantity = 0,
+           thread_quantity = 0;
+    bool first = true;
+
+    // Error check
+    if ( p_f == (void *) 0 ) goto failed_to_open;
+
+    // Scratch for a copy of one ring
+    p_records = NODE_REALLOC(0, NODE_TRACE_RING_SIZE * sizeof(node_trace_record));
+
+    // Error check
+    if ( p_records == (void *) 0 ) goto no_mem;
+
+    // Write in large blocks
+    setvbuf(p_f, (void *) 0, _IOFBF, 1 << 20);
+
+    // Begin the trace
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", p_f);
+
+    // Write the records of each thread
+    for (node_trace_ring *p_ring = atomic_load(&p_rings); p_ring; p_ring = p_ring->p_next)
+    {
+
+        // Initialized data
+        size_t head   = atomic_load_explicit(&p_ring->head, memory_order_acquire),
+               oldest = ( head > NODE_TRACE_RING_SIZE ) ? head - NODE_TRACE_RING_SIZE : 0,
+               begin  = oldest,
+               after  = 0;
+
+        // Copy the records
+        for (size_t i = oldest; i < head; i++) p_records[i - oldest] = p_ring->_records[i & NODE_TRACE_MASK];
+
+        // Records the thread wrote during the copy may have overwritten the oldest ones
+        after = atomic_load_explicit(&p_ring->head, memory_order_acquire);
+        if ( after >= NODE_TRACE_RING_SIZE && begin <= after - NODE_TRACE_RING_SIZE ) begin = after - NODE_TRACE_RING_SIZE + 1;
+
+        // Name the thread
+        fprintf(p_f, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"args\":{\"name\":\"thread %zu\"}}", ( first ) ? "" : ",", p_ring->thread, p_ring->thread);
+        first = false;
+        thread_quantity++;
+
+        // Write one complete event per run
+        for (size_t i = begin; i < head; i++)
+        {
+
+            // Initialized data
+            const node_trace_record *p_record = &p_records[i - oldest];
+
+            // Write the event
+            fputs(",\n{\"name\":\"", p_f);
+            node_trace_name_write(p_f, p_record->p_name);
+            fprintf(p_f, "\",\"cat\":\"node\",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"bytes\":%zu}}",
+                p_ring->thread,
+                (double) ( p_record->begin - start ) / 1000.0,
+                (double) ( p_record->end - p_record->begin ) / 1000.0,
+                p_record->bytes
+            );
+
+            event_quantity++;
+        }
+    }
+
+    // End the trace
+    fputs("\n]}\n", p_f);
+
+    // Release the scratch
+    p_records = NODE_REALLOC(p_records, 0);
+
+    // Error check
+    if ( fclose(p_f) ) goto failed_to_write;
+
+    // Log the flush
+    log_info("[node] [trace] Wrote %zu runs from %zu threads to \"%s\"\n", event_quantity, thread_quantity, p_path);
+
+    // Success
+    return 1;
+
+    // Error handling
+    {
+
+        // Argument errors
+        {
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[node] [trace] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+
+        // Standard library errors
+        {
+            failed_to_open:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to open file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // Release the file
+                fclose(p_f);
+
+                // Error
+                return 0;
+
+            failed_to_write:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to write file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // Error
+                return 0;
+        }
+    }
+}